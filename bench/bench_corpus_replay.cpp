@@ -0,0 +1,245 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// Fuzz-corpus replay harness doubling as a performance regression gate.
+//
+// Every file under fuzz/corpus/parser (the checked-in seeds the fuzz
+// targets start from) is replayed through Parser::parse_program each
+// benchmark iteration. The run reports aggregate corpus bytes/sec and the
+// worst single-input latency observed, then compares both against the
+// checked-in baseline (bench/corpus_baseline.txt) and exits non-zero when
+// either regresses beyond the tolerance — so adversarial-input parser
+// throughput is gated, not eyeballed.
+//
+// Usage:
+//   bench_corpus_replay                     replay and gate against baseline
+//   bench_corpus_replay --update-baseline   rewrite the baseline from this run
+//   bench_corpus_replay --baseline=<path>   gate against an alternate file
+//
+// A missing baseline file passes with a warning (fresh machines must be
+// able to run before recording one). The tolerance is deliberately wide:
+// the gate exists to catch algorithmic regressions (accidental O(n^2)
+// nesting blowups, quoting pathologies), not scheduler noise.
+
+#include "shell/parser.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace wshell;
+
+#ifndef WSHELL_CORPUS_DIR
+#define WSHELL_CORPUS_DIR "fuzz/corpus/parser"
+#endif
+#ifndef WSHELL_CORPUS_BASELINE
+#define WSHELL_CORPUS_BASELINE "bench/corpus_baseline.txt"
+#endif
+
+namespace {
+
+// Throughput may drop to 60% of baseline and worst-case latency grow to
+// 1.67x before the gate trips: wide enough for machine-to-machine noise,
+// tight enough that a complexity-class regression cannot hide
+constexpr double TOLERANCE = 0.60;
+
+struct CorpusInput {
+    std::string name;
+    std::string contents;
+};
+
+std::vector<CorpusInput> load_corpus(const std::filesystem::path& dir) {
+    std::vector<CorpusInput> corpus;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        if (!it->is_regular_file()) {
+            continue;
+        }
+        std::ifstream file(it->path(), std::ios::binary);
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        corpus.push_back({it->path().filename().string(), std::move(contents).str()});
+    }
+    // Directory iteration order is unspecified; sort for stable replay order
+    std::sort(corpus.begin(), corpus.end(),
+              [](const CorpusInput& a, const CorpusInput& b) { return a.name < b.name; });
+    return corpus;
+}
+
+// Worst single-input latency across the whole run, and which input caused it
+double g_worst_input_ns = 0;
+std::string g_worst_input_name;
+
+void BM_CorpusReplay(benchmark::State& state) {
+    static const std::vector<CorpusInput> corpus = load_corpus(WSHELL_CORPUS_DIR);
+    if (corpus.empty()) {
+        state.SkipWithError("no corpus files found under " WSHELL_CORPUS_DIR);
+        return;
+    }
+
+    std::int64_t bytes = 0;
+    // The first pass over the corpus pays cold caches and lazy page-ins;
+    // excluding it keeps the worst-case figure about the parser, not the OS
+    bool warm = false;
+    for (auto _ : state) {
+        for (const auto& input : corpus) {
+            const auto start = std::chrono::steady_clock::now();
+            auto result = parse_program(input.contents);
+            benchmark::DoNotOptimize(result);
+            const auto elapsed =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+            if (warm && static_cast<double>(elapsed) > g_worst_input_ns) {
+                g_worst_input_ns = static_cast<double>(elapsed);
+                g_worst_input_name = input.name;
+            }
+            bytes += static_cast<std::int64_t>(input.contents.size());
+        }
+        warm = true;
+    }
+    state.SetBytesProcessed(bytes);
+    state.counters["corpus_files"] = static_cast<double>(corpus.size());
+    state.counters["worst_input_ns"] = g_worst_input_ns;
+}
+BENCHMARK(BM_CorpusReplay)->Unit(benchmark::kMillisecond);
+
+/// Console reporter that additionally captures the metrics the gate needs
+class GateReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override {
+        ConsoleReporter::ReportRuns(runs);
+        for (const auto& run : runs) {
+            if (auto it = run.counters.find("bytes_per_second");
+                it != run.counters.end()) {
+                bytes_per_second = it->second;
+            }
+            if (auto it = run.counters.find("worst_input_ns");
+                it != run.counters.end()) {
+                worst_input_ns = it->second;
+            }
+        }
+    }
+
+    double bytes_per_second{0};
+    double worst_input_ns{0};
+};
+
+struct Baseline {
+    double bytes_per_second{0};
+    double worst_input_ns{0};
+    bool loaded{false};
+};
+
+Baseline read_baseline(const std::filesystem::path& path) {
+    Baseline baseline;
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return baseline;
+    }
+    std::string key;
+    double value = 0;
+    while (file >> key >> value) {
+        if (key == "bytes_per_second") {
+            baseline.bytes_per_second = value;
+        } else if (key == "worst_input_ns") {
+            baseline.worst_input_ns = value;
+        }
+    }
+    baseline.loaded = baseline.bytes_per_second > 0 && baseline.worst_input_ns > 0;
+    return baseline;
+}
+
+bool write_baseline(const std::filesystem::path& path, const GateReporter& measured) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "bytes_per_second " << measured.bytes_per_second << "\n"
+         << "worst_input_ns " << measured.worst_input_ns << "\n";
+    return static_cast<bool>(file);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::filesystem::path baseline_path = WSHELL_CORPUS_BASELINE;
+    bool update_baseline = false;
+
+    // Strip our flags before Google Benchmark sees the rest
+    std::vector<char*> passthrough;
+    for (int i = 0; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--update-baseline") {
+            update_baseline = true;
+        } else if (arg.starts_with("--baseline=")) {
+            baseline_path = std::string(arg.substr(std::string_view("--baseline=").size()));
+        } else {
+            passthrough.push_back(argv[i]);
+        }
+    }
+    int bench_argc = static_cast<int>(passthrough.size());
+
+    benchmark::Initialize(&bench_argc, passthrough.data());
+    GateReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    if (reporter.bytes_per_second <= 0) {
+        std::fprintf(stderr, "corpus gate: benchmark produced no throughput figure\n");
+        return 1;
+    }
+    std::printf("corpus replay: %.3g bytes/sec, worst input %.0f ns (%s)\n",
+                reporter.bytes_per_second, reporter.worst_input_ns,
+                g_worst_input_name.c_str());
+
+    if (update_baseline) {
+        if (!write_baseline(baseline_path, reporter)) {
+            std::fprintf(stderr, "corpus gate: cannot write baseline %s\n",
+                         baseline_path.string().c_str());
+            return 1;
+        }
+        std::printf("corpus gate: baseline updated (%s)\n", baseline_path.string().c_str());
+        return 0;
+    }
+
+    const Baseline baseline = read_baseline(baseline_path);
+    if (!baseline.loaded) {
+        std::fprintf(stderr,
+                     "corpus gate: no baseline at %s; passing (run with "
+                     "--update-baseline to record one)\n",
+                     baseline_path.string().c_str());
+        return 0;
+    }
+
+    bool ok = true;
+    if (reporter.bytes_per_second < baseline.bytes_per_second * TOLERANCE) {
+        std::fprintf(stderr,
+                     "corpus gate: FAIL throughput %.3g bytes/sec < %.0f%% of "
+                     "baseline %.3g\n",
+                     reporter.bytes_per_second, TOLERANCE * 100,
+                     baseline.bytes_per_second);
+        ok = false;
+    }
+    if (reporter.worst_input_ns > baseline.worst_input_ns / TOLERANCE) {
+        std::fprintf(stderr,
+                     "corpus gate: FAIL worst input %.0f ns (%s) > baseline "
+                     "%.0f ns / %.2f\n",
+                     reporter.worst_input_ns, g_worst_input_name.c_str(),
+                     baseline.worst_input_ns, TOLERANCE);
+        ok = false;
+    }
+    if (ok) {
+        std::printf("corpus gate: PASS (baseline %.3g bytes/sec, worst %.0f ns)\n",
+                    baseline.bytes_per_second, baseline.worst_input_ns);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// Execution-layer benchmarks: command launch latency is the shell's top
+// operational metric, so changes to the spawn path need numbers. The
+// FakeExecutionPolicy baseline isolates policy overhead from the real
+// kernel work of spawning.
+
+#include "shell/command_model.hpp"
+#include "shell/execution_policy.hpp"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace wshell {
+// Internal to executor_posix.cpp but deliberately given external linkage;
+// benchmarked directly to capture the cold (uncached) PATH walk.
+std::string findExecutableInPath(const std::string& executable_name);
+}  // namespace wshell
+
+using namespace wshell;
+
+namespace {
+
+Command make_true_command(bool by_name) {
+    // A bare name goes through PATH resolution; an absolute path bypasses it
+    return make_simple_command(by_name ? "true" : "/bin/true");
+}
+
+}  // namespace
+
+//==============================================================================
+// End-to-end spawn latency
+//==============================================================================
+
+static void BM_ExecuteTrueAbsolutePath(benchmark::State& state) {
+    PlatformExecutionPolicy policy;
+    auto cmd = make_true_command(/*by_name=*/false);
+    for (auto _ : state) {
+        auto result = policy.execute(cmd);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ExecuteTrueAbsolutePath)->Unit(benchmark::kMicrosecond);
+
+static void BM_ExecuteTrueByName(benchmark::State& state) {
+    // Same spawn, plus hot-cache PATH resolution in the parent
+    PlatformExecutionPolicy policy;
+    auto cmd = make_true_command(/*by_name=*/true);
+    for (auto _ : state) {
+        auto result = policy.execute(cmd);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ExecuteTrueByName)->Unit(benchmark::kMicrosecond);
+
+static void BM_ExecuteTrueWithEnvOverlay(benchmark::State& state) {
+    // Exercises the overlay branch of environment marshalling: the cached
+    // flat block cannot be reused verbatim, so per-spawn work is maximal
+    PlatformExecutionPolicy policy;
+    auto cmd = make_true_command(/*by_name=*/false);
+    for (int i = 0; i < 8; ++i) {
+        cmd.env.emplace_back("WSHELL_BENCH_VAR" + std::to_string(i),
+                             "value" + std::to_string(i));
+    }
+    for (auto _ : state) {
+        auto result = policy.execute(cmd);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ExecuteTrueWithEnvOverlay)->Unit(benchmark::kMicrosecond);
+
+static void BM_FakePolicyBaseline(benchmark::State& state) {
+    // Zero-cost baseline: everything except the actual spawn
+    FakeExecutionPolicy policy;
+    auto cmd = make_true_command(/*by_name=*/false);
+    for (auto _ : state) {
+        auto result = policy.execute(cmd);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_FakePolicyBaseline);
+
+//==============================================================================
+// Marshalling in isolation
+//==============================================================================
+
+static void BM_ConvertArgv(benchmark::State& state) {
+    std::vector<std::string> args;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        args.push_back("argument-" + std::to_string(i));
+    }
+    auto cmd = make_simple_command("/bin/true", std::move(args));
+    for (auto _ : state) {
+        auto argv = PlatformExecutionPolicy::convertArgv(cmd);
+        benchmark::DoNotOptimize(argv);
+    }
+    state.counters["args"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_ConvertArgv)->Arg(1)->Arg(8)->Arg(64);
+
+//==============================================================================
+// PATH resolution
+//==============================================================================
+
+static void BM_PathResolutionCold(benchmark::State& state) {
+    // Full $PATH walk with per-directory stat calls, no caching
+    for (auto _ : state) {
+        auto path = findExecutableInPath("true");
+        benchmark::DoNotOptimize(path);
+    }
+}
+BENCHMARK(BM_PathResolutionCold);
+
+//==============================================================================
+// Pipeline fan-out
+//==============================================================================
+
+static void BM_PipelineFanOut(benchmark::State& state) {
+    PlatformExecutionPolicy policy;
+    Pipeline pipeline;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        pipeline.commands.push_back(make_true_command(/*by_name=*/false));
+    }
+    for (auto _ : state) {
+        auto result = policy.execute(pipeline);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["stages"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_PipelineFanOut)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
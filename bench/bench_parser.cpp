@@ -1,14 +1,268 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// Lexer/parser/expansion benchmarks. Each benchmark reports bytes/sec plus
+// an allocs_per_iter counter (global operator new interposed below) so
+// regressions in the string-heavy paths show up directly in the numbers.
+
+#include "shell/alloc_stats.hpp"
 #include "shell/lexer.hpp"
+#include "shell/output_destination.hpp"
 #include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
 
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
 using namespace wshell;
 
-static void BM_LexParse(benchmark::State& state) {}
-BENCHMARK(BM_LexParse);
+//==============================================================================
+// Allocation counting
+//==============================================================================
+
+namespace {
+
+std::atomic<std::size_t> g_alloc_count{0};
+
+/// RAII window over the interposed operator new: reports allocations made
+/// between start() and a later read as a per-iteration benchmark counter.
+class AllocationWindow {
+public:
+    void start() { start_ = g_alloc_count.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::size_t count() const {
+        return g_alloc_count.load(std::memory_order_relaxed) - start_;
+    }
+
+    void report(benchmark::State& state) const {
+        state.counters["allocs_per_iter"] = benchmark::Counter(
+            static_cast<double>(count()),
+            benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    std::size_t start_{0};
+};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+//==============================================================================
+// Corpora
+//==============================================================================
+
+namespace {
+
+// Typical interactive line: the hot path in the REPL
+constexpr std::string_view kShortLine = "ls -l /tmp";
+
+// Long pipeline with redirections, the worst realistic single line
+constexpr std::string_view kLongPipeline =
+    "cat access.log | grep -v bot | cut -d: -f1 | sort | uniq -c "
+    "| sort -rn | head -n 20 > top_clients.txt";
+
+// Quote- and variable-heavy script fragment
+constexpr std::string_view kHeavyQuoting =
+    "let GREETING = \"hello 'quoted' world\"\n"
+    "echo \"$GREETING from $HOME\" # trailing comment\n"
+    "echo '$GREETING is not expanded here'\n"
+    "let PATHISH = \"/usr/bin:$HOME/bin:$HOME/.local/bin\"\n";
+
+/// A generated 10k-statement program exercising sustained throughput
+const std::string& large_program() {
+    static const std::string program = [] {
+        std::string text;
+        text.reserve(10'000 * 32);
+        for (int i = 0; i < 10'000; ++i) {
+            text += "echo statement number ";
+            text += std::to_string(i);
+            text += " # generated\n";
+        }
+        return text;
+    }();
+    return program;
+}
+
+std::string_view corpus_for(int index) {
+    switch (index) {
+        case 0: return kShortLine;
+        case 1: return kLongPipeline;
+        case 2: return kHeavyQuoting;
+        default: return large_program();
+    }
+}
+
+const char* corpus_name(int index) {
+    switch (index) {
+        case 0: return "short_line";
+        case 1: return "long_pipeline";
+        case 2: return "heavy_quoting";
+        default: return "10k_statements";
+    }
+}
+
+void apply_corpus_labels(benchmark::State& state, std::string_view corpus) {
+    state.SetLabel(corpus_name(static_cast<int>(state.range(0))));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(corpus.size()));
+}
+
+}  // namespace
+
+//==============================================================================
+// Lexer benchmarks
+//==============================================================================
+
+static void BM_LexerTokenize(benchmark::State& state) {
+    auto corpus = corpus_for(static_cast<int>(state.range(0)));
+    AllocationWindow allocs;
+    allocs.start();
+    for (auto _ : state) {
+        auto tokens = Lexer::tokenize(corpus);
+        benchmark::DoNotOptimize(tokens);
+    }
+    apply_corpus_labels(state, corpus);
+    allocs.report(state);
+}
+BENCHMARK(BM_LexerTokenize)->DenseRange(0, 3);
+
+static void BM_LexerTokenizeBuffer(benchmark::State& state) {
+    auto corpus = corpus_for(static_cast<int>(state.range(0)));
+    AllocationWindow allocs;
+    allocs.start();
+    for (auto _ : state) {
+        auto buffer = Lexer::tokenize_buffer(corpus);
+        benchmark::DoNotOptimize(buffer);
+    }
+    apply_corpus_labels(state, corpus);
+    allocs.report(state);
+}
+BENCHMARK(BM_LexerTokenizeBuffer)->DenseRange(0, 3);
+
+//==============================================================================
+// Parser benchmarks
+//==============================================================================
+
+static void BM_ParseProgram(benchmark::State& state) {
+    auto corpus = corpus_for(static_cast<int>(state.range(0)));
+    AllocationWindow allocs;
+    allocs.start();
+    for (auto _ : state) {
+        auto result = parse_program(corpus);
+        benchmark::DoNotOptimize(result);
+    }
+    apply_corpus_labels(state, corpus);
+    allocs.report(state);
+}
+BENCHMARK(BM_ParseProgram)->DenseRange(0, 3);
+
+static void BM_ParseLine(benchmark::State& state) {
+    // parse_line is the REPL entry point; only single-line corpora apply
+    auto corpus = corpus_for(static_cast<int>(state.range(0)));
+    AllocationWindow allocs;
+    allocs.start();
+    for (auto _ : state) {
+        auto result = parse_line(corpus);
+        benchmark::DoNotOptimize(result);
+    }
+    apply_corpus_labels(state, corpus);
+    allocs.report(state);
+}
+BENCHMARK(BM_ParseLine)->DenseRange(0, 1);
+
+static void BM_ParseAllocationsPerStatement(benchmark::State& state) {
+    // Per-subsystem view via AllocStats: an arena threaded through the
+    // counting resource attributes every AST node allocation, so the
+    // counter below is allocations-per-statement in the parser proper —
+    // the number the arena work is supposed to keep flat
+    const std::string& program = large_program();
+    std::pmr::monotonic_buffer_resource arena;
+    CountingMemoryResource counted(&arena, AllocSite::Ast);
+
+    const auto before = AllocStats::instance().snapshot(AllocSite::Ast);
+    std::size_t statements = 0;
+    for (auto _ : state) {
+        Parser parser(program, false, &counted);
+        while (true) {
+            auto stmt = parser.parse_next_statement();
+            if (!stmt || !stmt->has_value()) {
+                break;
+            }
+            ++statements;
+        }
+        arena.release();
+    }
+    const auto after = AllocStats::instance().snapshot(AllocSite::Ast);
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(program.size()));
+    if (statements > 0) {
+        state.counters["ast_allocs_per_stmt"] =
+            static_cast<double>(after.count - before.count) /
+            static_cast<double>(statements);
+        state.counters["ast_bytes_per_stmt"] =
+            static_cast<double>(after.bytes - before.bytes) /
+            static_cast<double>(statements);
+    }
+}
+BENCHMARK(BM_ParseAllocationsPerStatement);
+
+//==============================================================================
+// Variable expansion benchmarks
+//==============================================================================
+
+static void BM_ExpandVariables(benchmark::State& state) {
+    StringOutputDestination out;
+    StringOutputDestination err;
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+    interp.set_variable("HOME", "/home/bench");
+    interp.set_variable("USER", "bench");
+    interp.set_variable("GREETING", "hello world");
+
+    const std::string_view inputs[] = {
+        "echo plain text with no variables at all",
+        "echo $GREETING from $USER in $HOME",
+        "$HOME/$USER/$GREETING/$HOME/$USER/$GREETING",
+    };
+    auto input = inputs[state.range(0)];
+
+    AllocationWindow allocs;
+    allocs.start();
+    for (auto _ : state) {
+        auto expanded = interp.expand_variables(input);
+        benchmark::DoNotOptimize(expanded);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(input.size()));
+    allocs.report(state);
+}
+BENCHMARK(BM_ExpandVariables)->DenseRange(0, 2);
 
 BENCHMARK_MAIN();
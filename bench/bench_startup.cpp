@@ -0,0 +1,127 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// Startup benchmarks: wshell is launched from scripts thousands of times a
+// day, so cold-start cost is a fleet-wide tax and needs a number that CI
+// can watch. Two end-to-end figures matter — time-to-first-prompt (all the
+// work main does before it could read a line) and time-to-first-command
+// (that plus parsing and dispatching one statement) — plus the individual
+// startup stages so a regression points at its own cause. The fake
+// execution policy keeps kernel spawn cost out of the figures; history
+// loads asynchronously and the env snapshot builds on first spawn, so
+// neither shows up on these paths by design.
+
+#include "shell/alloc_stats.hpp"
+#include "shell/config.hpp"
+#include "shell/config_watcher.hpp"
+#include "shell/parser.hpp"
+#include "shell/plan_cache.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace wshell;
+
+namespace {
+
+// A representative rc file in a temp dir; the first loadCached call warms
+// the binary sidecar, so iterations measure the fleet-typical hit path
+const std::filesystem::path& bench_config_path() {
+    static const std::filesystem::path path = [] {
+        auto dir = std::filesystem::temp_directory_path() / "wshell_bench_startup";
+        std::filesystem::create_directories(dir);
+        auto file = dir / "wshellrc";
+        std::ofstream(file) << "PS1=wshell> \nPS2=> \nHISTORY_SIZE=1000\n";
+        (void)DefaultConfig::loadCached(file);  // warm the sidecar cache
+        return file;
+    }();
+    return path;
+}
+
+}  // namespace
+
+//==============================================================================
+// End-to-end startup figures
+//==============================================================================
+
+static void BM_StartupToFirstPrompt(benchmark::State& state) {
+    // Everything main sets up before it could paint a prompt: config load,
+    // interpreter (kicks off the async history read), seeded config
+    // watcher, per-line arena, parser session, plan cache, PS1 lookup
+    const auto& config_path = bench_config_path();
+    for (auto _ : state) {
+        auto config = DefaultConfig::loadCached(config_path);
+        StringOutputDestination out("stdout");
+        StringOutputDestination err("stderr");
+        ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+        ConfigWatcher watcher(config_path, config ? config->variables()
+                                                  : ConfigWatcher::Variables{});
+        std::pmr::monotonic_buffer_resource ast_arena;
+        CountingMemoryResource counted(&ast_arena, AllocSite::Ast);
+        ParserSession session(&counted);
+        PlanCache plan_cache;
+        auto prompt = watcher.get("PS1").value_or("wshell> ");
+        benchmark::DoNotOptimize(prompt);
+    }
+}
+BENCHMARK(BM_StartupToFirstPrompt)->Unit(benchmark::kMicrosecond);
+
+static void BM_StartupToFirstCommand(benchmark::State& state) {
+    // First prompt plus one parsed and dispatched statement — the figure
+    // that bounds `wshell -c`-style scripted invocations
+    const auto& config_path = bench_config_path();
+    for (auto _ : state) {
+        auto config = DefaultConfig::loadCached(config_path);
+        StringOutputDestination out("stdout");
+        StringOutputDestination err("stderr");
+        ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+        ConfigWatcher watcher(config_path, config ? config->variables()
+                                                  : ConfigWatcher::Variables{});
+        std::pmr::monotonic_buffer_resource ast_arena;
+        CountingMemoryResource counted(&ast_arena, AllocSite::Ast);
+        ParserSession session(&counted);
+        PlanCache plan_cache;
+        auto prompt = watcher.get("PS1").value_or("wshell> ");
+        benchmark::DoNotOptimize(prompt);
+
+        auto parsed = session.feed("run alpha");
+        int exit_code = parsed ? interp.execute_program(**parsed) : -1;
+        benchmark::DoNotOptimize(exit_code);
+    }
+}
+BENCHMARK(BM_StartupToFirstCommand)->Unit(benchmark::kMicrosecond);
+
+//==============================================================================
+// Individual startup stages
+//==============================================================================
+
+static void BM_StartupConfigLoadCachedHit(benchmark::State& state) {
+    // The only file read left on the first-prompt path: a sidecar hit
+    // (stat + one block read), no text parsing
+    const auto& config_path = bench_config_path();
+    for (auto _ : state) {
+        auto config = DefaultConfig::loadCached(config_path);
+        benchmark::DoNotOptimize(config);
+    }
+}
+BENCHMARK(BM_StartupConfigLoadCachedHit)->Unit(benchmark::kMicrosecond);
+
+static void BM_StartupInterpreterConstruction(benchmark::State& state) {
+    // Builtin table, variable store, and the async history kick-off; the
+    // history file itself streams in on a background thread and is merged
+    // on first access, so its size must not show up here
+    StringOutputDestination out("stdout");
+    StringOutputDestination err("stderr");
+    for (auto _ : state) {
+        ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+        benchmark::DoNotOptimize(&interp);
+    }
+}
+BENCHMARK(BM_StartupInterpreterConstruction)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
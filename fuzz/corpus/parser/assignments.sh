@@ -0,0 +1,4 @@
+let a = 1
+let b = two
+let c = $a
+echo $a $b ${c}
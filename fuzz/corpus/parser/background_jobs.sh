@@ -0,0 +1,3 @@
+sleep 10 &
+make -j8 &
+jobs
@@ -0,0 +1,3 @@
+# leading comment
+echo done # not a trailing comment in this grammar
+#########################################################################################################################################################################################################
@@ -0,0 +1,241 @@
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+for x in a do
+echo $x
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
+done
@@ -0,0 +1 @@
+echo $v0${w0}x$ $v1${w1}x$ $v2${w2}x$ $v3${w3}x$ $v4${w4}x$ $v5${w5}x$ $v6${w6}x$ $v7${w7}x$ $v8${w8}x$ $v9${w9}x$ $v10${w10}x$ $v11${w11}x$ $v12${w12}x$ $v13${w13}x$ $v14${w14}x$ $v15${w15}x$ $v16${w16}x$ $v17${w17}x$ $v18${w18}x$ $v19${w19}x$ $v20${w20}x$ $v21${w21}x$ $v22${w22}x$ $v23${w23}x$ $v24${w24}x$ $v25${w25}x$ $v26${w26}x$ $v27${w27}x$ $v28${w28}x$ $v29${w29}x$ $v30${w30}x$ $v31${w31}x$ $v32${w32}x$ $v33${w33}x$ $v34${w34}x$ $v35${w35}x$ $v36${w36}x$ $v37${w37}x$ $v38${w38}x$ $v39${w39}x$ $v40${w40}x$ $v41${w41}x$ $v42${w42}x$ $v43${w43}x$ $v44${w44}x$ $v45${w45}x$ $v46${w46}x$ $v47${w47}x$ $v48${w48}x$ $v49${w49}x$ $v50${w50}x$ $v51${w51}x$ $v52${w52}x$ $v53${w53}x$ $v54${w54}x$ $v55${w55}x$ $v56${w56}x$ $v57${w57}x$ $v58${w58}x$ $v59${w59}x$ $v60${w60}x$ $v61${w61}x$ $v62${w62}x$ $v63${w63}x$ $v64${w64}x$ $v65${w65}x$ $v66${w66}x$ $v67${w67}x$ $v68${w68}x$ $v69${w69}x$ $v70${w70}x$ $v71${w71}x$ $v72${w72}x$ $v73${w73}x$ $v74${w74}x$ $v75${w75}x$ $v76${w76}x$ $v77${w77}x$ $v78${w78}x$ $v79${w79}x$ $v80${w80}x$ $v81${w81}x$ $v82${w82}x$ $v83${w83}x$ $v84${w84}x$ $v85${w85}x$ $v86${w86}x$ $v87${w87}x$ $v88${w88}x$ $v89${w89}x$ $v90${w90}x$ $v91${w91}x$ $v92${w92}x$ $v93${w93}x$ $v94${w94}x$ $v95${w95}x$ $v96${w96}x$ $v97${w97}x$ $v98${w98}x$ $v99${w99}x$ $v100${w100}x$ $v101${w101}x$ $v102${w102}x$ $v103${w103}x$ $v104${w104}x$ $v105${w105}x$ $v106${w106}x$ $v107${w107}x$ $v108${w108}x$ $v109${w109}x$ $v110${w110}x$ $v111${w111}x$ $v112${w112}x$ $v113${w113}x$ $v114${w114}x$ $v115${w115}x$ $v116${w116}x$ $v117${w117}x$ $v118${w118}x$ $v119${w119}x$ $v120${w120}x$ $v121${w121}x$ $v122${w122}x$ $v123${w123}x$ $v124${w124}x$ $v125${w125}x$ $v126${w126}x$ $v127${w127}x$ $v128${w128}x$ $v129${w129}x$ $v130${w130}x$ $v131${w131}x$ $v132${w132}x$ $v133${w133}x$ $v134${w134}x$ $v135${w135}x$ $v136${w136}x$ $v137${w137}x$ $v138${w138}x$ $v139${w139}x$ $v140${w140}x$ $v141${w141}x$ $v142${w142}x$ $v143${w143}x$ $v144${w144}x$ $v145${w145}x$ $v146${w146}x$ $v147${w147}x$ $v148${w148}x$ $v149${w149}x$ $v150${w150}x$ $v151${w151}x$ $v152${w152}x$ $v153${w153}x$ $v154${w154}x$ $v155${w155}x$ $v156${w156}x$ $v157${w157}x$ $v158${w158}x$ $v159${w159}x$ $v160${w160}x$ $v161${w161}x$ $v162${w162}x$ $v163${w163}x$ $v164${w164}x$ $v165${w165}x$ $v166${w166}x$ $v167${w167}x$ $v168${w168}x$ $v169${w169}x$ $v170${w170}x$ $v171${w171}x$ $v172${w172}x$ $v173${w173}x$ $v174${w174}x$ $v175${w175}x$ $v176${w176}x$ $v177${w177}x$ $v178${w178}x$ $v179${w179}x$ $v180${w180}x$ $v181${w181}x$ $v182${w182}x$ $v183${w183}x$ $v184${w184}x$ $v185${w185}x$ $v186${w186}x$ $v187${w187}x$ $v188${w188}x$ $v189${w189}x$ $v190${w190}x$ $v191${w191}x$ $v192${w192}x$ $v193${w193}x$ $v194${w194}x$ $v195${w195}x$ $v196${w196}x$ $v197${w197}x$ $v198${w198}x$ $v199${w199}x$ $v200${w200}x$ $v201${w201}x$ $v202${w202}x$ $v203${w203}x$ $v204${w204}x$ $v205${w205}x$ $v206${w206}x$ $v207${w207}x$ $v208${w208}x$ $v209${w209}x$ $v210${w210}x$ $v211${w211}x$ $v212${w212}x$ $v213${w213}x$ $v214${w214}x$ $v215${w215}x$ $v216${w216}x$ $v217${w217}x$ $v218${w218}x$ $v219${w219}x$ $v220${w220}x$ $v221${w221}x$ $v222${w222}x$ $v223${w223}x$ $v224${w224}x$ $v225${w225}x$ $v226${w226}x$ $v227${w227}x$ $v228${w228}x$ $v229${w229}x$ $v230${w230}x$ $v231${w231}x$ $v232${w232}x$ $v233${w233}x$ $v234${w234}x$ $v235${w235}x$ $v236${w236}x$ $v237${w237}x$ $v238${w238}x$ $v239${w239}x$ $v240${w240}x$ $v241${w241}x$ $v242${w242}x$ $v243${w243}x$ $v244${w244}x$ $v245${w245}x$ $v246${w246}x$ $v247${w247}x$ $v248${w248}x$ $v249${w249}x$ $v250${w250}x$ $v251${w251}x$ $v252${w252}x$ $v253${w253}x$ $v254${w254}x$ $v255${w255}x$ $v256${w256}x$ $v257${w257}x$ $v258${w258}x$ $v259${w259}x$ $v260${w260}x$ $v261${w261}x$ $v262${w262}x$ $v263${w263}x$ $v264${w264}x$ $v265${w265}x$ $v266${w266}x$ $v267${w267}x$ $v268${w268}x$ $v269${w269}x$ $v270${w270}x$ $v271${w271}x$ $v272${w272}x$ $v273${w273}x$ $v274${w274}x$ $v275${w275}x$ $v276${w276}x$ $v277${w277}x$ $v278${w278}x$ $v279${w279}x$ $v280${w280}x$ $v281${w281}x$ $v282${w282}x$ $v283${w283}x$ $v284${w284}x$ $v285${w285}x$ $v286${w286}x$ $v287${w287}x$ $v288${w288}x$ $v289${w289}x$ $v290${w290}x$ $v291${w291}x$ $v292${w292}x$ $v293${w293}x$ $v294${w294}x$ $v295${w295}x$ $v296${w296}x$ $v297${w297}x$ $v298${w298}x$ $v299${w299}x$ $v300${w300}x$ $v301${w301}x$ $v302${w302}x$ $v303${w303}x$ $v304${w304}x$ $v305${w305}x$ $v306${w306}x$ $v307${w307}x$ $v308${w308}x$ $v309${w309}x$ $v310${w310}x$ $v311${w311}x$ $v312${w312}x$ $v313${w313}x$ $v314${w314}x$ $v315${w315}x$ $v316${w316}x$ $v317${w317}x$ $v318${w318}x$ $v319${w319}x$ $v320${w320}x$ $v321${w321}x$ $v322${w322}x$ $v323${w323}x$ $v324${w324}x$ $v325${w325}x$ $v326${w326}x$ $v327${w327}x$ $v328${w328}x$ $v329${w329}x$ $v330${w330}x$ $v331${w331}x$ $v332${w332}x$ $v333${w333}x$ $v334${w334}x$ $v335${w335}x$ $v336${w336}x$ $v337${w337}x$ $v338${w338}x$ $v339${w339}x$ $v340${w340}x$ $v341${w341}x$ $v342${w342}x$ $v343${w343}x$ $v344${w344}x$ $v345${w345}x$ $v346${w346}x$ $v347${w347}x$ $v348${w348}x$ $v349${w349}x$ $v350${w350}x$ $v351${w351}x$ $v352${w352}x$ $v353${w353}x$ $v354${w354}x$ $v355${w355}x$ $v356${w356}x$ $v357${w357}x$ $v358${w358}x$ $v359${w359}x$ $v360${w360}x$ $v361${w361}x$ $v362${w362}x$ $v363${w363}x$ $v364${w364}x$ $v365${w365}x$ $v366${w366}x$ $v367${w367}x$ $v368${w368}x$ $v369${w369}x$ $v370${w370}x$ $v371${w371}x$ $v372${w372}x$ $v373${w373}x$ $v374${w374}x$ $v375${w375}x$ $v376${w376}x$ $v377${w377}x$ $v378${w378}x$ $v379${w379}x$ $v380${w380}x$ $v381${w381}x$ $v382${w382}x$ $v383${w383}x$ $v384${w384}x$ $v385${w385}x$ $v386${w386}x$ $v387${w387}x$ $v388${w388}x$ $v389${w389}x$ $v390${w390}x$ $v391${w391}x$ $v392${w392}x$ $v393${w393}x$ $v394${w394}x$ $v395${w395}x$ $v396${w396}x$ $v397${w397}x$ $v398${w398}x$ $v399${w399}x$ $v400${w400}x$ $v401${w401}x$ $v402${w402}x$ $v403${w403}x$ $v404${w404}x$ $v405${w405}x$ $v406${w406}x$ $v407${w407}x$ $v408${w408}x$ $v409${w409}x$ $v410${w410}x$ $v411${w411}x$ $v412${w412}x$ $v413${w413}x$ $v414${w414}x$ $v415${w415}x$ $v416${w416}x$ $v417${w417}x$ $v418${w418}x$ $v419${w419}x$ $v420${w420}x$ $v421${w421}x$ $v422${w422}x$ $v423${w423}x$ $v424${w424}x$ $v425${w425}x$ $v426${w426}x$ $v427${w427}x$ $v428${w428}x$ $v429${w429}x$ $v430${w430}x$ $v431${w431}x$ $v432${w432}x$ $v433${w433}x$ $v434${w434}x$ $v435${w435}x$ $v436${w436}x$ $v437${w437}x$ $v438${w438}x$ $v439${w439}x$ $v440${w440}x$ $v441${w441}x$ $v442${w442}x$ $v443${w443}x$ $v444${w444}x$ $v445${w445}x$ $v446${w446}x$ $v447${w447}x$ $v448${w448}x$ $v449${w449}x$ $v450${w450}x$ $v451${w451}x$ $v452${w452}x$ $v453${w453}x$ $v454${w454}x$ $v455${w455}x$ $v456${w456}x$ $v457${w457}x$ $v458${w458}x$ $v459${w459}x$ $v460${w460}x$ $v461${w461}x$ $v462${w462}x$ $v463${w463}x$ $v464${w464}x$ $v465${w465}x$ $v466${w466}x$ $v467${w467}x$ $v468${w468}x$ $v469${w469}x$ $v470${w470}x$ $v471${w471}x$ $v472${w472}x$ $v473${w473}x$ $v474${w474}x$ $v475${w475}x$ $v476${w476}x$ $v477${w477}x$ $v478${w478}x$ $v479${w479}x$ $v480${w480}x$ $v481${w481}x$ $v482${w482}x$ $v483${w483}x$ $v484${w484}x$ $v485${w485}x$ $v486${w486}x$ $v487${w487}x$ $v488${w488}x$ $v489${w489}x$ $v490${w490}x$ $v491${w491}x$ $v492${w492}x$ $v493${w493}x$ $v494${w494}x$ $v495${w495}x$ $v496${w496}x$ $v497${w497}x$ $v498${w498}x$ $v499${w499}x$
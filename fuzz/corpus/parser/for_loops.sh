@@ -0,0 +1,6 @@
+for f in a b c do
+echo $f
+done
+for n in 1 2 3 par 2 do
+touch file-$n
+done
@@ -0,0 +1,5 @@
+function deploy do
+echo $1
+run step-$2
+done
+deploy prod fast
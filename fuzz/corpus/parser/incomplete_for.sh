@@ -0,0 +1,2 @@
+for f in a b c do
+echo $f
@@ -0,0 +1 @@
+cmd0 arg0; cmd1 arg1; cmd2 arg2; cmd3 arg3; cmd4 arg4; cmd5 arg5; cmd6 arg6; cmd7 arg7; cmd8 arg8; cmd9 arg9; cmd10 arg10; cmd11 arg11; cmd12 arg12; cmd13 arg13; cmd14 arg14; cmd15 arg15; cmd16 arg16; cmd17 arg17; cmd18 arg18; cmd19 arg19; cmd20 arg20; cmd21 arg21; cmd22 arg22; cmd23 arg23; cmd24 arg24; cmd25 arg25; cmd26 arg26; cmd27 arg27; cmd28 arg28; cmd29 arg29; cmd30 arg30; cmd31 arg31; cmd32 arg32; cmd33 arg33; cmd34 arg34; cmd35 arg35; cmd36 arg36; cmd37 arg37; cmd38 arg38; cmd39 arg39; cmd40 arg40; cmd41 arg41; cmd42 arg42; cmd43 arg43; cmd44 arg44; cmd45 arg45; cmd46 arg46; cmd47 arg47; cmd48 arg48; cmd49 arg49; cmd50 arg50; cmd51 arg51; cmd52 arg52; cmd53 arg53; cmd54 arg54; cmd55 arg55; cmd56 arg56; cmd57 arg57; cmd58 arg58; cmd59 arg59; cmd60 arg60; cmd61 arg61; cmd62 arg62; cmd63 arg63; cmd64 arg64; cmd65 arg65; cmd66 arg66; cmd67 arg67; cmd68 arg68; cmd69 arg69; cmd70 arg70; cmd71 arg71; cmd72 arg72; cmd73 arg73; cmd74 arg74; cmd75 arg75; cmd76 arg76; cmd77 arg77; cmd78 arg78; cmd79 arg79; cmd80 arg80; cmd81 arg81; cmd82 arg82; cmd83 arg83; cmd84 arg84; cmd85 arg85; cmd86 arg86; cmd87 arg87; cmd88 arg88; cmd89 arg89; cmd90 arg90; cmd91 arg91; cmd92 arg92; cmd93 arg93; cmd94 arg94; cmd95 arg95; cmd96 arg96; cmd97 arg97; cmd98 arg98; cmd99 arg99; cmd100 arg100; cmd101 arg101; cmd102 arg102; cmd103 arg103; cmd104 arg104; cmd105 arg105; cmd106 arg106; cmd107 arg107; cmd108 arg108; cmd109 arg109; cmd110 arg110; cmd111 arg111; cmd112 arg112; cmd113 arg113; cmd114 arg114; cmd115 arg115; cmd116 arg116; cmd117 arg117; cmd118 arg118; cmd119 arg119; cmd120 arg120; cmd121 arg121; cmd122 arg122; cmd123 arg123; cmd124 arg124; cmd125 arg125; cmd126 arg126; cmd127 arg127; cmd128 arg128; cmd129 arg129; cmd130 arg130; cmd131 arg131; cmd132 arg132; cmd133 arg133; cmd134 arg134; cmd135 arg135; cmd136 arg136; cmd137 arg137; cmd138 arg138; cmd139 arg139; cmd140 arg140; cmd141 arg141; cmd142 arg142; cmd143 arg143; cmd144 arg144; cmd145 arg145; cmd146 arg146; cmd147 arg147; cmd148 arg148; cmd149 arg149; cmd150 arg150; cmd151 arg151; cmd152 arg152; cmd153 arg153; cmd154 arg154; cmd155 arg155; cmd156 arg156; cmd157 arg157; cmd158 arg158; cmd159 arg159; cmd160 arg160; cmd161 arg161; cmd162 arg162; cmd163 arg163; cmd164 arg164; cmd165 arg165; cmd166 arg166; cmd167 arg167; cmd168 arg168; cmd169 arg169; cmd170 arg170; cmd171 arg171; cmd172 arg172; cmd173 arg173; cmd174 arg174; cmd175 arg175; cmd176 arg176; cmd177 arg177; cmd178 arg178; cmd179 arg179; cmd180 arg180; cmd181 arg181; cmd182 arg182; cmd183 arg183; cmd184 arg184; cmd185 arg185; cmd186 arg186; cmd187 arg187; cmd188 arg188; cmd189 arg189; cmd190 arg190; cmd191 arg191; cmd192 arg192; cmd193 arg193; cmd194 arg194; cmd195 arg195; cmd196 arg196; cmd197 arg197; cmd198 arg198; cmd199 arg199; cmd200 arg200; cmd201 arg201; cmd202 arg202; cmd203 arg203; cmd204 arg204; cmd205 arg205; cmd206 arg206; cmd207 arg207; cmd208 arg208; cmd209 arg209; cmd210 arg210; cmd211 arg211; cmd212 arg212; cmd213 arg213; cmd214 arg214; cmd215 arg215; cmd216 arg216; cmd217 arg217; cmd218 arg218; cmd219 arg219; cmd220 arg220; cmd221 arg221; cmd222 arg222; cmd223 arg223; cmd224 arg224; cmd225 arg225; cmd226 arg226; cmd227 arg227; cmd228 arg228; cmd229 arg229; cmd230 arg230; cmd231 arg231; cmd232 arg232; cmd233 arg233; cmd234 arg234; cmd235 arg235; cmd236 arg236; cmd237 arg237; cmd238 arg238; cmd239 arg239; cmd240 arg240; cmd241 arg241; cmd242 arg242; cmd243 arg243; cmd244 arg244; cmd245 arg245; cmd246 arg246; cmd247 arg247; cmd248 arg248; cmd249 arg249; cmd250 arg250; cmd251 arg251; cmd252 arg252; cmd253 arg253; cmd254 arg254; cmd255 arg255; cmd256 arg256; cmd257 arg257; cmd258 arg258; cmd259 arg259; cmd260 arg260; cmd261 arg261; cmd262 arg262; cmd263 arg263; cmd264 arg264; cmd265 arg265; cmd266 arg266; cmd267 arg267; cmd268 arg268; cmd269 arg269; cmd270 arg270; cmd271 arg271; cmd272 arg272; cmd273 arg273; cmd274 arg274; cmd275 arg275; cmd276 arg276; cmd277 arg277; cmd278 arg278; cmd279 arg279; cmd280 arg280; cmd281 arg281; cmd282 arg282; cmd283 arg283; cmd284 arg284; cmd285 arg285; cmd286 arg286; cmd287 arg287; cmd288 arg288; cmd289 arg289; cmd290 arg290; cmd291 arg291; cmd292 arg292; cmd293 arg293; cmd294 arg294; cmd295 arg295; cmd296 arg296; cmd297 arg297; cmd298 arg298; cmd299 arg299; cmd300 arg300; cmd301 arg301; cmd302 arg302; cmd303 arg303; cmd304 arg304; cmd305 arg305; cmd306 arg306; cmd307 arg307; cmd308 arg308; cmd309 arg309; cmd310 arg310; cmd311 arg311; cmd312 arg312; cmd313 arg313; cmd314 arg314; cmd315 arg315; cmd316 arg316; cmd317 arg317; cmd318 arg318; cmd319 arg319; cmd320 arg320; cmd321 arg321; cmd322 arg322; cmd323 arg323; cmd324 arg324; cmd325 arg325; cmd326 arg326; cmd327 arg327; cmd328 arg328; cmd329 arg329; cmd330 arg330; cmd331 arg331; cmd332 arg332; cmd333 arg333; cmd334 arg334; cmd335 arg335; cmd336 arg336; cmd337 arg337; cmd338 arg338; cmd339 arg339; cmd340 arg340; cmd341 arg341; cmd342 arg342; cmd343 arg343; cmd344 arg344; cmd345 arg345; cmd346 arg346; cmd347 arg347; cmd348 arg348; cmd349 arg349; cmd350 arg350; cmd351 arg351; cmd352 arg352; cmd353 arg353; cmd354 arg354; cmd355 arg355; cmd356 arg356; cmd357 arg357; cmd358 arg358; cmd359 arg359; cmd360 arg360; cmd361 arg361; cmd362 arg362; cmd363 arg363; cmd364 arg364; cmd365 arg365; cmd366 arg366; cmd367 arg367; cmd368 arg368; cmd369 arg369; cmd370 arg370; cmd371 arg371; cmd372 arg372; cmd373 arg373; cmd374 arg374; cmd375 arg375; cmd376 arg376; cmd377 arg377; cmd378 arg378; cmd379 arg379; cmd380 arg380; cmd381 arg381; cmd382 arg382; cmd383 arg383; cmd384 arg384; cmd385 arg385; cmd386 arg386; cmd387 arg387; cmd388 arg388; cmd389 arg389; cmd390 arg390; cmd391 arg391; cmd392 arg392; cmd393 arg393; cmd394 arg394; cmd395 arg395; cmd396 arg396; cmd397 arg397; cmd398 arg398; cmd399 arg399; cmd400 arg400; cmd401 arg401; cmd402 arg402; cmd403 arg403; cmd404 arg404; cmd405 arg405; cmd406 arg406; cmd407 arg407; cmd408 arg408; cmd409 arg409; cmd410 arg410; cmd411 arg411; cmd412 arg412; cmd413 arg413; cmd414 arg414; cmd415 arg415; cmd416 arg416; cmd417 arg417; cmd418 arg418; cmd419 arg419; cmd420 arg420; cmd421 arg421; cmd422 arg422; cmd423 arg423; cmd424 arg424; cmd425 arg425; cmd426 arg426; cmd427 arg427; cmd428 arg428; cmd429 arg429; cmd430 arg430; cmd431 arg431; cmd432 arg432; cmd433 arg433; cmd434 arg434; cmd435 arg435; cmd436 arg436; cmd437 arg437; cmd438 arg438; cmd439 arg439; cmd440 arg440; cmd441 arg441; cmd442 arg442; cmd443 arg443; cmd444 arg444; cmd445 arg445; cmd446 arg446; cmd447 arg447; cmd448 arg448; cmd449 arg449; cmd450 arg450; cmd451 arg451; cmd452 arg452; cmd453 arg453; cmd454 arg454; cmd455 arg455; cmd456 arg456; cmd457 arg457; cmd458 arg458; cmd459 arg459; cmd460 arg460; cmd461 arg461; cmd462 arg462; cmd463 arg463; cmd464 arg464; cmd465 arg465; cmd466 arg466; cmd467 arg467; cmd468 arg468; cmd469 arg469; cmd470 arg470; cmd471 arg471; cmd472 arg472; cmd473 arg473; cmd474 arg474; cmd475 arg475; cmd476 arg476; cmd477 arg477; cmd478 arg478; cmd479 arg479; cmd480 arg480; cmd481 arg481; cmd482 arg482; cmd483 arg483; cmd484 arg484; cmd485 arg485; cmd486 arg486; cmd487 arg487; cmd488 arg488; cmd489 arg489; cmd490 arg490; cmd491 arg491; cmd492 arg492; cmd493 arg493; cmd494 arg494; cmd495 arg495; cmd496 arg496; cmd497 arg497; cmd498 arg498; cmd499 arg499; cmd500 arg500; cmd501 arg501; cmd502 arg502; cmd503 arg503; cmd504 arg504; cmd505 arg505; cmd506 arg506; cmd507 arg507; cmd508 arg508; cmd509 arg509; cmd510 arg510; cmd511 arg511; cmd512 arg512; cmd513 arg513; cmd514 arg514; cmd515 arg515; cmd516 arg516; cmd517 arg517; cmd518 arg518; cmd519 arg519; cmd520 arg520; cmd521 arg521; cmd522 arg522; cmd523 arg523; cmd524 arg524; cmd525 arg525; cmd526 arg526; cmd527 arg527; cmd528 arg528; cmd529 arg529; cmd530 arg530; cmd531 arg531; cmd532 arg532; cmd533 arg533; cmd534 arg534; cmd535 arg535; cmd536 arg536; cmd537 arg537; cmd538 arg538; cmd539 arg539; cmd540 arg540; cmd541 arg541; cmd542 arg542; cmd543 arg543; cmd544 arg544; cmd545 arg545; cmd546 arg546; cmd547 arg547; cmd548 arg548; cmd549 arg549; cmd550 arg550; cmd551 arg551; cmd552 arg552; cmd553 arg553; cmd554 arg554; cmd555 arg555; cmd556 arg556; cmd557 arg557; cmd558 arg558; cmd559 arg559; cmd560 arg560; cmd561 arg561; cmd562 arg562; cmd563 arg563; cmd564 arg564; cmd565 arg565; cmd566 arg566; cmd567 arg567; cmd568 arg568; cmd569 arg569; cmd570 arg570; cmd571 arg571; cmd572 arg572; cmd573 arg573; cmd574 arg574; cmd575 arg575; cmd576 arg576; cmd577 arg577; cmd578 arg578; cmd579 arg579; cmd580 arg580; cmd581 arg581; cmd582 arg582; cmd583 arg583; cmd584 arg584; cmd585 arg585; cmd586 arg586; cmd587 arg587; cmd588 arg588; cmd589 arg589; cmd590 arg590; cmd591 arg591; cmd592 arg592; cmd593 arg593; cmd594 arg594; cmd595 arg595; cmd596 arg596; cmd597 arg597; cmd598 arg598; cmd599 arg599; cmd600 arg600; cmd601 arg601; cmd602 arg602; cmd603 arg603; cmd604 arg604; cmd605 arg605; cmd606 arg606; cmd607 arg607; cmd608 arg608; cmd609 arg609; cmd610 arg610; cmd611 arg611; cmd612 arg612; cmd613 arg613; cmd614 arg614; cmd615 arg615; cmd616 arg616; cmd617 arg617; cmd618 arg618; cmd619 arg619; cmd620 arg620; cmd621 arg621; cmd622 arg622; cmd623 arg623; cmd624 arg624; cmd625 arg625; cmd626 arg626; cmd627 arg627; cmd628 arg628; cmd629 arg629; cmd630 arg630; cmd631 arg631; cmd632 arg632; cmd633 arg633; cmd634 arg634; cmd635 arg635; cmd636 arg636; cmd637 arg637; cmd638 arg638; cmd639 arg639; cmd640 arg640; cmd641 arg641; cmd642 arg642; cmd643 arg643; cmd644 arg644; cmd645 arg645; cmd646 arg646; cmd647 arg647; cmd648 arg648; cmd649 arg649; cmd650 arg650; cmd651 arg651; cmd652 arg652; cmd653 arg653; cmd654 arg654; cmd655 arg655; cmd656 arg656; cmd657 arg657; cmd658 arg658; cmd659 arg659; cmd660 arg660; cmd661 arg661; cmd662 arg662; cmd663 arg663; cmd664 arg664; cmd665 arg665; cmd666 arg666; cmd667 arg667; cmd668 arg668; cmd669 arg669; cmd670 arg670; cmd671 arg671; cmd672 arg672; cmd673 arg673; cmd674 arg674; cmd675 arg675; cmd676 arg676; cmd677 arg677; cmd678 arg678; cmd679 arg679; cmd680 arg680; cmd681 arg681; cmd682 arg682; cmd683 arg683; cmd684 arg684; cmd685 arg685; cmd686 arg686; cmd687 arg687; cmd688 arg688; cmd689 arg689; cmd690 arg690; cmd691 arg691; cmd692 arg692; cmd693 arg693; cmd694 arg694; cmd695 arg695; cmd696 arg696; cmd697 arg697; cmd698 arg698; cmd699 arg699; cmd700 arg700; cmd701 arg701; cmd702 arg702; cmd703 arg703; cmd704 arg704; cmd705 arg705; cmd706 arg706; cmd707 arg707; cmd708 arg708; cmd709 arg709; cmd710 arg710; cmd711 arg711; cmd712 arg712; cmd713 arg713; cmd714 arg714; cmd715 arg715; cmd716 arg716; cmd717 arg717; cmd718 arg718; cmd719 arg719; cmd720 arg720; cmd721 arg721; cmd722 arg722; cmd723 arg723; cmd724 arg724; cmd725 arg725; cmd726 arg726; cmd727 arg727; cmd728 arg728; cmd729 arg729; cmd730 arg730; cmd731 arg731; cmd732 arg732; cmd733 arg733; cmd734 arg734; cmd735 arg735; cmd736 arg736; cmd737 arg737; cmd738 arg738; cmd739 arg739; cmd740 arg740; cmd741 arg741; cmd742 arg742; cmd743 arg743; cmd744 arg744; cmd745 arg745; cmd746 arg746; cmd747 arg747; cmd748 arg748; cmd749 arg749; cmd750 arg750; cmd751 arg751; cmd752 arg752; cmd753 arg753; cmd754 arg754; cmd755 arg755; cmd756 arg756; cmd757 arg757; cmd758 arg758; cmd759 arg759; cmd760 arg760; cmd761 arg761; cmd762 arg762; cmd763 arg763; cmd764 arg764; cmd765 arg765; cmd766 arg766; cmd767 arg767; cmd768 arg768; cmd769 arg769; cmd770 arg770; cmd771 arg771; cmd772 arg772; cmd773 arg773; cmd774 arg774; cmd775 arg775; cmd776 arg776; cmd777 arg777; cmd778 arg778; cmd779 arg779; cmd780 arg780; cmd781 arg781; cmd782 arg782; cmd783 arg783; cmd784 arg784; cmd785 arg785; cmd786 arg786; cmd787 arg787; cmd788 arg788; cmd789 arg789; cmd790 arg790; cmd791 arg791; cmd792 arg792; cmd793 arg793; cmd794 arg794; cmd795 arg795; cmd796 arg796; cmd797 arg797; cmd798 arg798; cmd799 arg799; cmd800 arg800; cmd801 arg801; cmd802 arg802; cmd803 arg803; cmd804 arg804; cmd805 arg805; cmd806 arg806; cmd807 arg807; cmd808 arg808; cmd809 arg809; cmd810 arg810; cmd811 arg811; cmd812 arg812; cmd813 arg813; cmd814 arg814; cmd815 arg815; cmd816 arg816; cmd817 arg817; cmd818 arg818; cmd819 arg819; cmd820 arg820; cmd821 arg821; cmd822 arg822; cmd823 arg823; cmd824 arg824; cmd825 arg825; cmd826 arg826; cmd827 arg827; cmd828 arg828; cmd829 arg829; cmd830 arg830; cmd831 arg831; cmd832 arg832; cmd833 arg833; cmd834 arg834; cmd835 arg835; cmd836 arg836; cmd837 arg837; cmd838 arg838; cmd839 arg839; cmd840 arg840; cmd841 arg841; cmd842 arg842; cmd843 arg843; cmd844 arg844; cmd845 arg845; cmd846 arg846; cmd847 arg847; cmd848 arg848; cmd849 arg849; cmd850 arg850; cmd851 arg851; cmd852 arg852; cmd853 arg853; cmd854 arg854; cmd855 arg855; cmd856 arg856; cmd857 arg857; cmd858 arg858; cmd859 arg859; cmd860 arg860; cmd861 arg861; cmd862 arg862; cmd863 arg863; cmd864 arg864; cmd865 arg865; cmd866 arg866; cmd867 arg867; cmd868 arg868; cmd869 arg869; cmd870 arg870; cmd871 arg871; cmd872 arg872; cmd873 arg873; cmd874 arg874; cmd875 arg875; cmd876 arg876; cmd877 arg877; cmd878 arg878; cmd879 arg879; cmd880 arg880; cmd881 arg881; cmd882 arg882; cmd883 arg883; cmd884 arg884; cmd885 arg885; cmd886 arg886; cmd887 arg887; cmd888 arg888; cmd889 arg889; cmd890 arg890; cmd891 arg891; cmd892 arg892; cmd893 arg893; cmd894 arg894; cmd895 arg895; cmd896 arg896; cmd897 arg897; cmd898 arg898; cmd899 arg899; cmd900 arg900; cmd901 arg901; cmd902 arg902; cmd903 arg903; cmd904 arg904; cmd905 arg905; cmd906 arg906; cmd907 arg907; cmd908 arg908; cmd909 arg909; cmd910 arg910; cmd911 arg911; cmd912 arg912; cmd913 arg913; cmd914 arg914; cmd915 arg915; cmd916 arg916; cmd917 arg917; cmd918 arg918; cmd919 arg919; cmd920 arg920; cmd921 arg921; cmd922 arg922; cmd923 arg923; cmd924 arg924; cmd925 arg925; cmd926 arg926; cmd927 arg927; cmd928 arg928; cmd929 arg929; cmd930 arg930; cmd931 arg931; cmd932 arg932; cmd933 arg933; cmd934 arg934; cmd935 arg935; cmd936 arg936; cmd937 arg937; cmd938 arg938; cmd939 arg939; cmd940 arg940; cmd941 arg941; cmd942 arg942; cmd943 arg943; cmd944 arg944; cmd945 arg945; cmd946 arg946; cmd947 arg947; cmd948 arg948; cmd949 arg949; cmd950 arg950; cmd951 arg951; cmd952 arg952; cmd953 arg953; cmd954 arg954; cmd955 arg955; cmd956 arg956; cmd957 arg957; cmd958 arg958; cmd959 arg959; cmd960 arg960; cmd961 arg961; cmd962 arg962; cmd963 arg963; cmd964 arg964; cmd965 arg965; cmd966 arg966; cmd967 arg967; cmd968 arg968; cmd969 arg969; cmd970 arg970; cmd971 arg971; cmd972 arg972; cmd973 arg973; cmd974 arg974; cmd975 arg975; cmd976 arg976; cmd977 arg977; cmd978 arg978; cmd979 arg979; cmd980 arg980; cmd981 arg981; cmd982 arg982; cmd983 arg983; cmd984 arg984; cmd985 arg985; cmd986 arg986; cmd987 arg987; cmd988 arg988; cmd989 arg989; cmd990 arg990; cmd991 arg991; cmd992 arg992; cmd993 arg993; cmd994 arg994; cmd995 arg995; cmd996 arg996; cmd997 arg997; cmd998 arg998; cmd999 arg999; cmd1000 arg1000; cmd1001 arg1001; cmd1002 arg1002; cmd1003 arg1003; cmd1004 arg1004; cmd1005 arg1005; cmd1006 arg1006; cmd1007 arg1007; cmd1008 arg1008; cmd1009 arg1009; cmd1010 arg1010; cmd1011 arg1011; cmd1012 arg1012; cmd1013 arg1013; cmd1014 arg1014; cmd1015 arg1015; cmd1016 arg1016; cmd1017 arg1017; cmd1018 arg1018; cmd1019 arg1019; cmd1020 arg1020; cmd1021 arg1021; cmd1022 arg1022; cmd1023 arg1023; cmd1024 arg1024; cmd1025 arg1025; cmd1026 arg1026; cmd1027 arg1027; cmd1028 arg1028; cmd1029 arg1029; cmd1030 arg1030; cmd1031 arg1031; cmd1032 arg1032; cmd1033 arg1033; cmd1034 arg1034; cmd1035 arg1035; cmd1036 arg1036; cmd1037 arg1037; cmd1038 arg1038; cmd1039 arg1039; cmd1040 arg1040; cmd1041 arg1041; cmd1042 arg1042; cmd1043 arg1043; cmd1044 arg1044; cmd1045 arg1045; cmd1046 arg1046; cmd1047 arg1047; cmd1048 arg1048; cmd1049 arg1049; cmd1050 arg1050; cmd1051 arg1051; cmd1052 arg1052; cmd1053 arg1053; cmd1054 arg1054; cmd1055 arg1055; cmd1056 arg1056; cmd1057 arg1057; cmd1058 arg1058; cmd1059 arg1059; cmd1060 arg1060; cmd1061 arg1061; cmd1062 arg1062; cmd1063 arg1063; cmd1064 arg1064; cmd1065 arg1065; cmd1066 arg1066; cmd1067 arg1067; cmd1068 arg1068; cmd1069 arg1069; cmd1070 arg1070; cmd1071 arg1071; cmd1072 arg1072; cmd1073 arg1073; cmd1074 arg1074; cmd1075 arg1075; cmd1076 arg1076; cmd1077 arg1077; cmd1078 arg1078; cmd1079 arg1079; cmd1080 arg1080; cmd1081 arg1081; cmd1082 arg1082; cmd1083 arg1083; cmd1084 arg1084; cmd1085 arg1085; cmd1086 arg1086; cmd1087 arg1087; cmd1088 arg1088; cmd1089 arg1089; cmd1090 arg1090; cmd1091 arg1091; cmd1092 arg1092; cmd1093 arg1093; cmd1094 arg1094; cmd1095 arg1095; cmd1096 arg1096; cmd1097 arg1097; cmd1098 arg1098; cmd1099 arg1099; cmd1100 arg1100; cmd1101 arg1101; cmd1102 arg1102; cmd1103 arg1103; cmd1104 arg1104; cmd1105 arg1105; cmd1106 arg1106; cmd1107 arg1107; cmd1108 arg1108; cmd1109 arg1109; cmd1110 arg1110; cmd1111 arg1111; cmd1112 arg1112; cmd1113 arg1113; cmd1114 arg1114; cmd1115 arg1115; cmd1116 arg1116; cmd1117 arg1117; cmd1118 arg1118; cmd1119 arg1119; cmd1120 arg1120; cmd1121 arg1121; cmd1122 arg1122; cmd1123 arg1123; cmd1124 arg1124; cmd1125 arg1125; cmd1126 arg1126; cmd1127 arg1127; cmd1128 arg1128; cmd1129 arg1129; cmd1130 arg1130; cmd1131 arg1131; cmd1132 arg1132; cmd1133 arg1133; cmd1134 arg1134; cmd1135 arg1135; cmd1136 arg1136; cmd1137 arg1137; cmd1138 arg1138; cmd1139 arg1139; cmd1140 arg1140; cmd1141 arg1141; cmd1142 arg1142; cmd1143 arg1143; cmd1144 arg1144; cmd1145 arg1145; cmd1146 arg1146; cmd1147 arg1147; cmd1148 arg1148; cmd1149 arg1149; cmd1150 arg1150; cmd1151 arg1151; cmd1152 arg1152; cmd1153 arg1153; cmd1154 arg1154; cmd1155 arg1155; cmd1156 arg1156; cmd1157 arg1157; cmd1158 arg1158; cmd1159 arg1159; cmd1160 arg1160; cmd1161 arg1161; cmd1162 arg1162; cmd1163 arg1163; cmd1164 arg1164; cmd1165 arg1165; cmd1166 arg1166; cmd1167 arg1167; cmd1168 arg1168; cmd1169 arg1169; cmd1170 arg1170; cmd1171 arg1171; cmd1172 arg1172; cmd1173 arg1173; cmd1174 arg1174; cmd1175 arg1175; cmd1176 arg1176; cmd1177 arg1177; cmd1178 arg1178; cmd1179 arg1179; cmd1180 arg1180; cmd1181 arg1181; cmd1182 arg1182; cmd1183 arg1183; cmd1184 arg1184; cmd1185 arg1185; cmd1186 arg1186; cmd1187 arg1187; cmd1188 arg1188; cmd1189 arg1189; cmd1190 arg1190; cmd1191 arg1191; cmd1192 arg1192; cmd1193 arg1193; cmd1194 arg1194; cmd1195 arg1195; cmd1196 arg1196; cmd1197 arg1197; cmd1198 arg1198; cmd1199 arg1199; cmd1200 arg1200; cmd1201 arg1201; cmd1202 arg1202; cmd1203 arg1203; cmd1204 arg1204; cmd1205 arg1205; cmd1206 arg1206; cmd1207 arg1207; cmd1208 arg1208; cmd1209 arg1209; cmd1210 arg1210; cmd1211 arg1211; cmd1212 arg1212; cmd1213 arg1213; cmd1214 arg1214; cmd1215 arg1215; cmd1216 arg1216; cmd1217 arg1217; cmd1218 arg1218; cmd1219 arg1219; cmd1220 arg1220; cmd1221 arg1221; cmd1222 arg1222; cmd1223 arg1223; cmd1224 arg1224; cmd1225 arg1225; cmd1226 arg1226; cmd1227 arg1227; cmd1228 arg1228; cmd1229 arg1229; cmd1230 arg1230; cmd1231 arg1231; cmd1232 arg1232; cmd1233 arg1233; cmd1234 arg1234; cmd1235 arg1235; cmd1236 arg1236; cmd1237 arg1237; cmd1238 arg1238; cmd1239 arg1239; cmd1240 arg1240; cmd1241 arg1241; cmd1242 arg1242; cmd1243 arg1243; cmd1244 arg1244; cmd1245 arg1245; cmd1246 arg1246; cmd1247 arg1247; cmd1248 arg1248; cmd1249 arg1249; cmd1250 arg1250; cmd1251 arg1251; cmd1252 arg1252; cmd1253 arg1253; cmd1254 arg1254; cmd1255 arg1255; cmd1256 arg1256; cmd1257 arg1257; cmd1258 arg1258; cmd1259 arg1259; cmd1260 arg1260; cmd1261 arg1261; cmd1262 arg1262; cmd1263 arg1263; cmd1264 arg1264; cmd1265 arg1265; cmd1266 arg1266; cmd1267 arg1267; cmd1268 arg1268; cmd1269 arg1269; cmd1270 arg1270; cmd1271 arg1271; cmd1272 arg1272; cmd1273 arg1273; cmd1274 arg1274; cmd1275 arg1275; cmd1276 arg1276; cmd1277 arg1277; cmd1278 arg1278; cmd1279 arg1279; cmd1280 arg1280; cmd1281 arg1281; cmd1282 arg1282; cmd1283 arg1283; cmd1284 arg1284; cmd1285 arg1285; cmd1286 arg1286; cmd1287 arg1287; cmd1288 arg1288; cmd1289 arg1289; cmd1290 arg1290; cmd1291 arg1291; cmd1292 arg1292; cmd1293 arg1293; cmd1294 arg1294; cmd1295 arg1295; cmd1296 arg1296; cmd1297 arg1297; cmd1298 arg1298; cmd1299 arg1299; cmd1300 arg1300; cmd1301 arg1301; cmd1302 arg1302; cmd1303 arg1303; cmd1304 arg1304; cmd1305 arg1305; cmd1306 arg1306; cmd1307 arg1307; cmd1308 arg1308; cmd1309 arg1309; cmd1310 arg1310; cmd1311 arg1311; cmd1312 arg1312; cmd1313 arg1313; cmd1314 arg1314; cmd1315 arg1315; cmd1316 arg1316; cmd1317 arg1317; cmd1318 arg1318; cmd1319 arg1319; cmd1320 arg1320; cmd1321 arg1321; cmd1322 arg1322; cmd1323 arg1323; cmd1324 arg1324; cmd1325 arg1325; cmd1326 arg1326; cmd1327 arg1327; cmd1328 arg1328; cmd1329 arg1329; cmd1330 arg1330; cmd1331 arg1331; cmd1332 arg1332; cmd1333 arg1333; cmd1334 arg1334; cmd1335 arg1335; cmd1336 arg1336; cmd1337 arg1337; cmd1338 arg1338; cmd1339 arg1339; cmd1340 arg1340; cmd1341 arg1341; cmd1342 arg1342; cmd1343 arg1343; cmd1344 arg1344; cmd1345 arg1345; cmd1346 arg1346; cmd1347 arg1347; cmd1348 arg1348; cmd1349 arg1349; cmd1350 arg1350; cmd1351 arg1351; cmd1352 arg1352; cmd1353 arg1353; cmd1354 arg1354; cmd1355 arg1355; cmd1356 arg1356; cmd1357 arg1357; cmd1358 arg1358; cmd1359 arg1359; cmd1360 arg1360; cmd1361 arg1361; cmd1362 arg1362; cmd1363 arg1363; cmd1364 arg1364; cmd1365 arg1365; cmd1366 arg1366; cmd1367 arg1367; cmd1368 arg1368; cmd1369 arg1369; cmd1370 arg1370; cmd1371 arg1371; cmd1372 arg1372; cmd1373 arg1373; cmd1374 arg1374; cmd1375 arg1375; cmd1376 arg1376; cmd1377 arg1377; cmd1378 arg1378; cmd1379 arg1379; cmd1380 arg1380; cmd1381 arg1381; cmd1382 arg1382; cmd1383 arg1383; cmd1384 arg1384; cmd1385 arg1385; cmd1386 arg1386; cmd1387 arg1387; cmd1388 arg1388; cmd1389 arg1389; cmd1390 arg1390; cmd1391 arg1391; cmd1392 arg1392; cmd1393 arg1393; cmd1394 arg1394; cmd1395 arg1395; cmd1396 arg1396; cmd1397 arg1397; cmd1398 arg1398; cmd1399 arg1399; cmd1400 arg1400; cmd1401 arg1401; cmd1402 arg1402; cmd1403 arg1403; cmd1404 arg1404; cmd1405 arg1405; cmd1406 arg1406; cmd1407 arg1407; cmd1408 arg1408; cmd1409 arg1409; cmd1410 arg1410; cmd1411 arg1411; cmd1412 arg1412; cmd1413 arg1413; cmd1414 arg1414; cmd1415 arg1415; cmd1416 arg1416; cmd1417 arg1417; cmd1418 arg1418; cmd1419 arg1419; cmd1420 arg1420; cmd1421 arg1421; cmd1422 arg1422; cmd1423 arg1423; cmd1424 arg1424; cmd1425 arg1425; cmd1426 arg1426; cmd1427 arg1427; cmd1428 arg1428; cmd1429 arg1429; cmd1430 arg1430; cmd1431 arg1431; cmd1432 arg1432; cmd1433 arg1433; cmd1434 arg1434; cmd1435 arg1435; cmd1436 arg1436; cmd1437 arg1437; cmd1438 arg1438; cmd1439 arg1439; cmd1440 arg1440; cmd1441 arg1441; cmd1442 arg1442; cmd1443 arg1443; cmd1444 arg1444; cmd1445 arg1445; cmd1446 arg1446; cmd1447 arg1447; cmd1448 arg1448; cmd1449 arg1449; cmd1450 arg1450; cmd1451 arg1451; cmd1452 arg1452; cmd1453 arg1453; cmd1454 arg1454; cmd1455 arg1455; cmd1456 arg1456; cmd1457 arg1457; cmd1458 arg1458; cmd1459 arg1459; cmd1460 arg1460; cmd1461 arg1461; cmd1462 arg1462; cmd1463 arg1463; cmd1464 arg1464; cmd1465 arg1465; cmd1466 arg1466; cmd1467 arg1467; cmd1468 arg1468; cmd1469 arg1469; cmd1470 arg1470; cmd1471 arg1471; cmd1472 arg1472; cmd1473 arg1473; cmd1474 arg1474; cmd1475 arg1475; cmd1476 arg1476; cmd1477 arg1477; cmd1478 arg1478; cmd1479 arg1479; cmd1480 arg1480; cmd1481 arg1481; cmd1482 arg1482; cmd1483 arg1483; cmd1484 arg1484; cmd1485 arg1485; cmd1486 arg1486; cmd1487 arg1487; cmd1488 arg1488; cmd1489 arg1489; cmd1490 arg1490; cmd1491 arg1491; cmd1492 arg1492; cmd1493 arg1493; cmd1494 arg1494; cmd1495 arg1495; cmd1496 arg1496; cmd1497 arg1497; cmd1498 arg1498; cmd1499 arg1499; cmd1500 arg1500; cmd1501 arg1501; cmd1502 arg1502; cmd1503 arg1503; cmd1504 arg1504; cmd1505 arg1505; cmd1506 arg1506; cmd1507 arg1507; cmd1508 arg1508; cmd1509 arg1509; cmd1510 arg1510; cmd1511 arg1511; cmd1512 arg1512; cmd1513 arg1513; cmd1514 arg1514; cmd1515 arg1515; cmd1516 arg1516; cmd1517 arg1517; cmd1518 arg1518; cmd1519 arg1519; cmd1520 arg1520; cmd1521 arg1521; cmd1522 arg1522; cmd1523 arg1523; cmd1524 arg1524; cmd1525 arg1525; cmd1526 arg1526; cmd1527 arg1527; cmd1528 arg1528; cmd1529 arg1529; cmd1530 arg1530; cmd1531 arg1531; cmd1532 arg1532; cmd1533 arg1533; cmd1534 arg1534; cmd1535 arg1535; cmd1536 arg1536; cmd1537 arg1537; cmd1538 arg1538; cmd1539 arg1539; cmd1540 arg1540; cmd1541 arg1541; cmd1542 arg1542; cmd1543 arg1543; cmd1544 arg1544; cmd1545 arg1545; cmd1546 arg1546; cmd1547 arg1547; cmd1548 arg1548; cmd1549 arg1549; cmd1550 arg1550; cmd1551 arg1551; cmd1552 arg1552; cmd1553 arg1553; cmd1554 arg1554; cmd1555 arg1555; cmd1556 arg1556; cmd1557 arg1557; cmd1558 arg1558; cmd1559 arg1559; cmd1560 arg1560; cmd1561 arg1561; cmd1562 arg1562; cmd1563 arg1563; cmd1564 arg1564; cmd1565 arg1565; cmd1566 arg1566; cmd1567 arg1567; cmd1568 arg1568; cmd1569 arg1569; cmd1570 arg1570; cmd1571 arg1571; cmd1572 arg1572; cmd1573 arg1573; cmd1574 arg1574; cmd1575 arg1575; cmd1576 arg1576; cmd1577 arg1577; cmd1578 arg1578; cmd1579 arg1579; cmd1580 arg1580; cmd1581 arg1581; cmd1582 arg1582; cmd1583 arg1583; cmd1584 arg1584; cmd1585 arg1585; cmd1586 arg1586; cmd1587 arg1587; cmd1588 arg1588; cmd1589 arg1589; cmd1590 arg1590; cmd1591 arg1591; cmd1592 arg1592; cmd1593 arg1593; cmd1594 arg1594; cmd1595 arg1595; cmd1596 arg1596; cmd1597 arg1597; cmd1598 arg1598; cmd1599 arg1599; cmd1600 arg1600; cmd1601 arg1601; cmd1602 arg1602; cmd1603 arg1603; cmd1604 arg1604; cmd1605 arg1605; cmd1606 arg1606; cmd1607 arg1607; cmd1608 arg1608; cmd1609 arg1609; cmd1610 arg1610; cmd1611 arg1611; cmd1612 arg1612; cmd1613 arg1613; cmd1614 arg1614; cmd1615 arg1615; cmd1616 arg1616; cmd1617 arg1617; cmd1618 arg1618; cmd1619 arg1619; cmd1620 arg1620; cmd1621 arg1621; cmd1622 arg1622; cmd1623 arg1623; cmd1624 arg1624; cmd1625 arg1625; cmd1626 arg1626; cmd1627 arg1627; cmd1628 arg1628; cmd1629 arg1629; cmd1630 arg1630; cmd1631 arg1631; cmd1632 arg1632; cmd1633 arg1633; cmd1634 arg1634; cmd1635 arg1635; cmd1636 arg1636; cmd1637 arg1637; cmd1638 arg1638; cmd1639 arg1639; cmd1640 arg1640; cmd1641 arg1641; cmd1642 arg1642; cmd1643 arg1643; cmd1644 arg1644; cmd1645 arg1645; cmd1646 arg1646; cmd1647 arg1647; cmd1648 arg1648; cmd1649 arg1649; cmd1650 arg1650; cmd1651 arg1651; cmd1652 arg1652; cmd1653 arg1653; cmd1654 arg1654; cmd1655 arg1655; cmd1656 arg1656; cmd1657 arg1657; cmd1658 arg1658; cmd1659 arg1659; cmd1660 arg1660; cmd1661 arg1661; cmd1662 arg1662; cmd1663 arg1663; cmd1664 arg1664; cmd1665 arg1665; cmd1666 arg1666; cmd1667 arg1667; cmd1668 arg1668; cmd1669 arg1669; cmd1670 arg1670; cmd1671 arg1671; cmd1672 arg1672; cmd1673 arg1673; cmd1674 arg1674; cmd1675 arg1675; cmd1676 arg1676; cmd1677 arg1677; cmd1678 arg1678; cmd1679 arg1679; cmd1680 arg1680; cmd1681 arg1681; cmd1682 arg1682; cmd1683 arg1683; cmd1684 arg1684; cmd1685 arg1685; cmd1686 arg1686; cmd1687 arg1687; cmd1688 arg1688; cmd1689 arg1689; cmd1690 arg1690; cmd1691 arg1691; cmd1692 arg1692; cmd1693 arg1693; cmd1694 arg1694; cmd1695 arg1695; cmd1696 arg1696; cmd1697 arg1697; cmd1698 arg1698; cmd1699 arg1699; cmd1700 arg1700; cmd1701 arg1701; cmd1702 arg1702; cmd1703 arg1703; cmd1704 arg1704; cmd1705 arg1705; cmd1706 arg1706; cmd1707 arg1707; cmd1708 arg1708; cmd1709 arg1709; cmd1710 arg1710; cmd1711 arg1711; cmd1712 arg1712; cmd1713 arg1713; cmd1714 arg1714; cmd1715 arg1715; cmd1716 arg1716; cmd1717 arg1717; cmd1718 arg1718; cmd1719 arg1719; cmd1720 arg1720; cmd1721 arg1721; cmd1722 arg1722; cmd1723 arg1723; cmd1724 arg1724; cmd1725 arg1725; cmd1726 arg1726; cmd1727 arg1727; cmd1728 arg1728; cmd1729 arg1729; cmd1730 arg1730; cmd1731 arg1731; cmd1732 arg1732; cmd1733 arg1733; cmd1734 arg1734; cmd1735 arg1735; cmd1736 arg1736; cmd1737 arg1737; cmd1738 arg1738; cmd1739 arg1739; cmd1740 arg1740; cmd1741 arg1741; cmd1742 arg1742; cmd1743 arg1743; cmd1744 arg1744; cmd1745 arg1745; cmd1746 arg1746; cmd1747 arg1747; cmd1748 arg1748; cmd1749 arg1749; cmd1750 arg1750; cmd1751 arg1751; cmd1752 arg1752; cmd1753 arg1753; cmd1754 arg1754; cmd1755 arg1755; cmd1756 arg1756; cmd1757 arg1757; cmd1758 arg1758; cmd1759 arg1759; cmd1760 arg1760; cmd1761 arg1761; cmd1762 arg1762; cmd1763 arg1763; cmd1764 arg1764; cmd1765 arg1765; cmd1766 arg1766; cmd1767 arg1767; cmd1768 arg1768; cmd1769 arg1769; cmd1770 arg1770; cmd1771 arg1771; cmd1772 arg1772; cmd1773 arg1773; cmd1774 arg1774; cmd1775 arg1775; cmd1776 arg1776; cmd1777 arg1777; cmd1778 arg1778; cmd1779 arg1779; cmd1780 arg1780; cmd1781 arg1781; cmd1782 arg1782; cmd1783 arg1783; cmd1784 arg1784; cmd1785 arg1785; cmd1786 arg1786; cmd1787 arg1787; cmd1788 arg1788; cmd1789 arg1789; cmd1790 arg1790; cmd1791 arg1791; cmd1792 arg1792; cmd1793 arg1793; cmd1794 arg1794; cmd1795 arg1795; cmd1796 arg1796; cmd1797 arg1797; cmd1798 arg1798; cmd1799 arg1799; cmd1800 arg1800; cmd1801 arg1801; cmd1802 arg1802; cmd1803 arg1803; cmd1804 arg1804; cmd1805 arg1805; cmd1806 arg1806; cmd1807 arg1807; cmd1808 arg1808; cmd1809 arg1809; cmd1810 arg1810; cmd1811 arg1811; cmd1812 arg1812; cmd1813 arg1813; cmd1814 arg1814; cmd1815 arg1815; cmd1816 arg1816; cmd1817 arg1817; cmd1818 arg1818; cmd1819 arg1819; cmd1820 arg1820; cmd1821 arg1821; cmd1822 arg1822; cmd1823 arg1823; cmd1824 arg1824; cmd1825 arg1825; cmd1826 arg1826; cmd1827 arg1827; cmd1828 arg1828; cmd1829 arg1829; cmd1830 arg1830; cmd1831 arg1831; cmd1832 arg1832; cmd1833 arg1833; cmd1834 arg1834; cmd1835 arg1835; cmd1836 arg1836; cmd1837 arg1837; cmd1838 arg1838; cmd1839 arg1839; cmd1840 arg1840; cmd1841 arg1841; cmd1842 arg1842; cmd1843 arg1843; cmd1844 arg1844; cmd1845 arg1845; cmd1846 arg1846; cmd1847 arg1847; cmd1848 arg1848; cmd1849 arg1849; cmd1850 arg1850; cmd1851 arg1851; cmd1852 arg1852; cmd1853 arg1853; cmd1854 arg1854; cmd1855 arg1855; cmd1856 arg1856; cmd1857 arg1857; cmd1858 arg1858; cmd1859 arg1859; cmd1860 arg1860; cmd1861 arg1861; cmd1862 arg1862; cmd1863 arg1863; cmd1864 arg1864; cmd1865 arg1865; cmd1866 arg1866; cmd1867 arg1867; cmd1868 arg1868; cmd1869 arg1869; cmd1870 arg1870; cmd1871 arg1871; cmd1872 arg1872; cmd1873 arg1873; cmd1874 arg1874; cmd1875 arg1875; cmd1876 arg1876; cmd1877 arg1877; cmd1878 arg1878; cmd1879 arg1879; cmd1880 arg1880; cmd1881 arg1881; cmd1882 arg1882; cmd1883 arg1883; cmd1884 arg1884; cmd1885 arg1885; cmd1886 arg1886; cmd1887 arg1887; cmd1888 arg1888; cmd1889 arg1889; cmd1890 arg1890; cmd1891 arg1891; cmd1892 arg1892; cmd1893 arg1893; cmd1894 arg1894; cmd1895 arg1895; cmd1896 arg1896; cmd1897 arg1897; cmd1898 arg1898; cmd1899 arg1899; cmd1900 arg1900; cmd1901 arg1901; cmd1902 arg1902; cmd1903 arg1903; cmd1904 arg1904; cmd1905 arg1905; cmd1906 arg1906; cmd1907 arg1907; cmd1908 arg1908; cmd1909 arg1909; cmd1910 arg1910; cmd1911 arg1911; cmd1912 arg1912; cmd1913 arg1913; cmd1914 arg1914; cmd1915 arg1915; cmd1916 arg1916; cmd1917 arg1917; cmd1918 arg1918; cmd1919 arg1919; cmd1920 arg1920; cmd1921 arg1921; cmd1922 arg1922; cmd1923 arg1923; cmd1924 arg1924; cmd1925 arg1925; cmd1926 arg1926; cmd1927 arg1927; cmd1928 arg1928; cmd1929 arg1929; cmd1930 arg1930; cmd1931 arg1931; cmd1932 arg1932; cmd1933 arg1933; cmd1934 arg1934; cmd1935 arg1935; cmd1936 arg1936; cmd1937 arg1937; cmd1938 arg1938; cmd1939 arg1939; cmd1940 arg1940; cmd1941 arg1941; cmd1942 arg1942; cmd1943 arg1943; cmd1944 arg1944; cmd1945 arg1945; cmd1946 arg1946; cmd1947 arg1947; cmd1948 arg1948; cmd1949 arg1949; cmd1950 arg1950; cmd1951 arg1951; cmd1952 arg1952; cmd1953 arg1953; cmd1954 arg1954; cmd1955 arg1955; cmd1956 arg1956; cmd1957 arg1957; cmd1958 arg1958; cmd1959 arg1959; cmd1960 arg1960; cmd1961 arg1961; cmd1962 arg1962; cmd1963 arg1963; cmd1964 arg1964; cmd1965 arg1965; cmd1966 arg1966; cmd1967 arg1967; cmd1968 arg1968; cmd1969 arg1969; cmd1970 arg1970; cmd1971 arg1971; cmd1972 arg1972; cmd1973 arg1973; cmd1974 arg1974; cmd1975 arg1975; cmd1976 arg1976; cmd1977 arg1977; cmd1978 arg1978; cmd1979 arg1979; cmd1980 arg1980; cmd1981 arg1981; cmd1982 arg1982; cmd1983 arg1983; cmd1984 arg1984; cmd1985 arg1985; cmd1986 arg1986; cmd1987 arg1987; cmd1988 arg1988; cmd1989 arg1989; cmd1990 arg1990; cmd1991 arg1991; cmd1992 arg1992; cmd1993 arg1993; cmd1994 arg1994; cmd1995 arg1995; cmd1996 arg1996; cmd1997 arg1997; cmd1998 arg1998; cmd1999 arg1999
@@ -0,0 +1,300 @@
+git log --oneline -0 | head -0
+let rev = r0
+echo $rev > /tmp/out0
+git log --oneline -1 | head -1
+let rev = r1
+echo $rev > /tmp/out1
+git log --oneline -2 | head -2
+let rev = r2
+echo $rev > /tmp/out2
+git log --oneline -3 | head -3
+let rev = r3
+echo $rev > /tmp/out3
+git log --oneline -4 | head -4
+let rev = r4
+echo $rev > /tmp/out4
+git log --oneline -5 | head -5
+let rev = r5
+echo $rev > /tmp/out5
+git log --oneline -6 | head -6
+let rev = r6
+echo $rev > /tmp/out6
+git log --oneline -7 | head -7
+let rev = r7
+echo $rev > /tmp/out7
+git log --oneline -8 | head -8
+let rev = r8
+echo $rev > /tmp/out8
+git log --oneline -9 | head -9
+let rev = r9
+echo $rev > /tmp/out9
+git log --oneline -10 | head -10
+let rev = r10
+echo $rev > /tmp/out10
+git log --oneline -11 | head -11
+let rev = r11
+echo $rev > /tmp/out11
+git log --oneline -12 | head -12
+let rev = r12
+echo $rev > /tmp/out12
+git log --oneline -13 | head -13
+let rev = r13
+echo $rev > /tmp/out13
+git log --oneline -14 | head -14
+let rev = r14
+echo $rev > /tmp/out14
+git log --oneline -15 | head -15
+let rev = r15
+echo $rev > /tmp/out15
+git log --oneline -16 | head -16
+let rev = r16
+echo $rev > /tmp/out16
+git log --oneline -17 | head -17
+let rev = r17
+echo $rev > /tmp/out17
+git log --oneline -18 | head -18
+let rev = r18
+echo $rev > /tmp/out18
+git log --oneline -19 | head -19
+let rev = r19
+echo $rev > /tmp/out19
+git log --oneline -20 | head -20
+let rev = r20
+echo $rev > /tmp/out20
+git log --oneline -21 | head -21
+let rev = r21
+echo $rev > /tmp/out21
+git log --oneline -22 | head -22
+let rev = r22
+echo $rev > /tmp/out22
+git log --oneline -23 | head -23
+let rev = r23
+echo $rev > /tmp/out23
+git log --oneline -24 | head -24
+let rev = r24
+echo $rev > /tmp/out24
+git log --oneline -25 | head -25
+let rev = r25
+echo $rev > /tmp/out25
+git log --oneline -26 | head -26
+let rev = r26
+echo $rev > /tmp/out26
+git log --oneline -27 | head -27
+let rev = r27
+echo $rev > /tmp/out27
+git log --oneline -28 | head -28
+let rev = r28
+echo $rev > /tmp/out28
+git log --oneline -29 | head -29
+let rev = r29
+echo $rev > /tmp/out29
+git log --oneline -30 | head -30
+let rev = r30
+echo $rev > /tmp/out30
+git log --oneline -31 | head -31
+let rev = r31
+echo $rev > /tmp/out31
+git log --oneline -32 | head -32
+let rev = r32
+echo $rev > /tmp/out32
+git log --oneline -33 | head -33
+let rev = r33
+echo $rev > /tmp/out33
+git log --oneline -34 | head -34
+let rev = r34
+echo $rev > /tmp/out34
+git log --oneline -35 | head -35
+let rev = r35
+echo $rev > /tmp/out35
+git log --oneline -36 | head -36
+let rev = r36
+echo $rev > /tmp/out36
+git log --oneline -37 | head -37
+let rev = r37
+echo $rev > /tmp/out37
+git log --oneline -38 | head -38
+let rev = r38
+echo $rev > /tmp/out38
+git log --oneline -39 | head -39
+let rev = r39
+echo $rev > /tmp/out39
+git log --oneline -40 | head -40
+let rev = r40
+echo $rev > /tmp/out40
+git log --oneline -41 | head -41
+let rev = r41
+echo $rev > /tmp/out41
+git log --oneline -42 | head -42
+let rev = r42
+echo $rev > /tmp/out42
+git log --oneline -43 | head -43
+let rev = r43
+echo $rev > /tmp/out43
+git log --oneline -44 | head -44
+let rev = r44
+echo $rev > /tmp/out44
+git log --oneline -45 | head -45
+let rev = r45
+echo $rev > /tmp/out45
+git log --oneline -46 | head -46
+let rev = r46
+echo $rev > /tmp/out46
+git log --oneline -47 | head -47
+let rev = r47
+echo $rev > /tmp/out47
+git log --oneline -48 | head -48
+let rev = r48
+echo $rev > /tmp/out48
+git log --oneline -49 | head -49
+let rev = r49
+echo $rev > /tmp/out49
+git log --oneline -50 | head -50
+let rev = r50
+echo $rev > /tmp/out50
+git log --oneline -51 | head -51
+let rev = r51
+echo $rev > /tmp/out51
+git log --oneline -52 | head -52
+let rev = r52
+echo $rev > /tmp/out52
+git log --oneline -53 | head -53
+let rev = r53
+echo $rev > /tmp/out53
+git log --oneline -54 | head -54
+let rev = r54
+echo $rev > /tmp/out54
+git log --oneline -55 | head -55
+let rev = r55
+echo $rev > /tmp/out55
+git log --oneline -56 | head -56
+let rev = r56
+echo $rev > /tmp/out56
+git log --oneline -57 | head -57
+let rev = r57
+echo $rev > /tmp/out57
+git log --oneline -58 | head -58
+let rev = r58
+echo $rev > /tmp/out58
+git log --oneline -59 | head -59
+let rev = r59
+echo $rev > /tmp/out59
+git log --oneline -60 | head -60
+let rev = r60
+echo $rev > /tmp/out60
+git log --oneline -61 | head -61
+let rev = r61
+echo $rev > /tmp/out61
+git log --oneline -62 | head -62
+let rev = r62
+echo $rev > /tmp/out62
+git log --oneline -63 | head -63
+let rev = r63
+echo $rev > /tmp/out63
+git log --oneline -64 | head -64
+let rev = r64
+echo $rev > /tmp/out64
+git log --oneline -65 | head -65
+let rev = r65
+echo $rev > /tmp/out65
+git log --oneline -66 | head -66
+let rev = r66
+echo $rev > /tmp/out66
+git log --oneline -67 | head -67
+let rev = r67
+echo $rev > /tmp/out67
+git log --oneline -68 | head -68
+let rev = r68
+echo $rev > /tmp/out68
+git log --oneline -69 | head -69
+let rev = r69
+echo $rev > /tmp/out69
+git log --oneline -70 | head -70
+let rev = r70
+echo $rev > /tmp/out70
+git log --oneline -71 | head -71
+let rev = r71
+echo $rev > /tmp/out71
+git log --oneline -72 | head -72
+let rev = r72
+echo $rev > /tmp/out72
+git log --oneline -73 | head -73
+let rev = r73
+echo $rev > /tmp/out73
+git log --oneline -74 | head -74
+let rev = r74
+echo $rev > /tmp/out74
+git log --oneline -75 | head -75
+let rev = r75
+echo $rev > /tmp/out75
+git log --oneline -76 | head -76
+let rev = r76
+echo $rev > /tmp/out76
+git log --oneline -77 | head -77
+let rev = r77
+echo $rev > /tmp/out77
+git log --oneline -78 | head -78
+let rev = r78
+echo $rev > /tmp/out78
+git log --oneline -79 | head -79
+let rev = r79
+echo $rev > /tmp/out79
+git log --oneline -80 | head -80
+let rev = r80
+echo $rev > /tmp/out80
+git log --oneline -81 | head -81
+let rev = r81
+echo $rev > /tmp/out81
+git log --oneline -82 | head -82
+let rev = r82
+echo $rev > /tmp/out82
+git log --oneline -83 | head -83
+let rev = r83
+echo $rev > /tmp/out83
+git log --oneline -84 | head -84
+let rev = r84
+echo $rev > /tmp/out84
+git log --oneline -85 | head -85
+let rev = r85
+echo $rev > /tmp/out85
+git log --oneline -86 | head -86
+let rev = r86
+echo $rev > /tmp/out86
+git log --oneline -87 | head -87
+let rev = r87
+echo $rev > /tmp/out87
+git log --oneline -88 | head -88
+let rev = r88
+echo $rev > /tmp/out88
+git log --oneline -89 | head -89
+let rev = r89
+echo $rev > /tmp/out89
+git log --oneline -90 | head -90
+let rev = r90
+echo $rev > /tmp/out90
+git log --oneline -91 | head -91
+let rev = r91
+echo $rev > /tmp/out91
+git log --oneline -92 | head -92
+let rev = r92
+echo $rev > /tmp/out92
+git log --oneline -93 | head -93
+let rev = r93
+echo $rev > /tmp/out93
+git log --oneline -94 | head -94
+let rev = r94
+echo $rev > /tmp/out94
+git log --oneline -95 | head -95
+let rev = r95
+echo $rev > /tmp/out95
+git log --oneline -96 | head -96
+let rev = r96
+echo $rev > /tmp/out96
+git log --oneline -97 | head -97
+let rev = r97
+echo $rev > /tmp/out97
+git log --oneline -98 | head -98
+let rev = r98
+echo $rev > /tmp/out98
+git log --oneline -99 | head -99
+let rev = r99
+echo $rev > /tmp/out99
@@ -0,0 +1 @@
+echo "a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d"a"b"c"d
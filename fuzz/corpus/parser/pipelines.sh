@@ -0,0 +1,20 @@
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
+cat file | grep foo | sort | uniq -c | head
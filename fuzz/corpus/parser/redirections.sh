@@ -0,0 +1,30 @@
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
+sort < in.txt > out.txt
+cat >> append.log
+echo x > /dev/null
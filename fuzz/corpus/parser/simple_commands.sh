@@ -0,0 +1,3 @@
+echo hello
+ls -l /tmp
+pwd
@@ -0,0 +1,4 @@
+| | |
+> 
+let = broken
+for in do done
@@ -0,0 +1,150 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// alloc_stats.hpp - Per-subsystem allocation counters
+//
+// Answers "who is churning the allocator" without running heaptrack on a
+// production box: each instrumented subsystem attributes its allocations
+// (count + bytes) to a fixed site, via either an explicit record() call at
+// the point of allocation or a CountingMemoryResource threaded into a pmr
+// container chain. Recording is one relaxed atomic add per event, cheap
+// enough to stay on in production builds, and compiles out entirely when
+// the build defines WSHELL_ALLOC_STATS=0 (same switch discipline as
+// WSHELL_TRACE_EXEC). The `stats` builtin and the --mem-stats exit report
+// render the counters; bench_parser reads them to report AST allocations
+// per statement. This is the measurement side of the arena/interning work:
+// without counters those wins are unverifiable.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#ifndef WSHELL_ALLOC_STATS
+    #define WSHELL_ALLOC_STATS 1
+#endif
+
+namespace wshell {
+
+/// Compile-time switch: when false every record() collapses to nothing
+inline constexpr bool kAllocStatsCompiledIn = (WSHELL_ALLOC_STATS != 0);
+
+/// Instrumented allocation sites. Keep kAllocSiteCount in sync.
+enum class AllocSite : std::size_t {
+    Lexer = 0,       // StringPool interning (bytes copied on first sight)
+    Ast = 1,         // parser AST nodes (via the counted arena resource)
+    Expansion = 2,   // ShellInterpreter variable/substitution expansion
+    History = 3,     // History ring entries
+    ExecMarshal = 4, // Command marshalling for the executor
+};
+
+inline constexpr std::size_t kAllocSiteCount = 5;
+
+/// Display name for a site (fixed table, no allocation)
+[[nodiscard]] constexpr const char* alloc_site_name(AllocSite site) noexcept {
+    switch (site) {
+        case AllocSite::Lexer:       return "lexer";
+        case AllocSite::Ast:         return "ast";
+        case AllocSite::Expansion:   return "expansion";
+        case AllocSite::History:     return "history";
+        case AllocSite::ExecMarshal: return "exec";
+    }
+    return "unknown";
+}
+
+/// Process-wide allocation counters, one count/bytes pair per site.
+/// Same singleton pattern as StageStats; all operations are lock-free.
+class AllocStats {
+public:
+    static AllocStats& instance() {
+        static AllocStats stats;
+        return stats;
+    }
+
+    /// Attribute one allocation of `bytes` to a site. Two relaxed atomic
+    /// adds; a complete no-op when the instrumentation is compiled out.
+    void record(AllocSite site, std::size_t bytes) noexcept {
+        if constexpr (kAllocStatsCompiledIn) {
+            auto& counter = counters_[static_cast<std::size_t>(site)];
+            counter.count.fetch_add(1, std::memory_order_relaxed);
+            counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        } else {
+            (void)site;
+            (void)bytes;
+        }
+    }
+
+    /// Point-in-time reading of one site's counters
+    struct Snapshot {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    [[nodiscard]] Snapshot snapshot(AllocSite site) const noexcept {
+        const auto& counter = counters_[static_cast<std::size_t>(site)];
+        return {counter.count.load(std::memory_order_relaxed),
+                counter.bytes.load(std::memory_order_relaxed)};
+    }
+
+    /// Sum across all sites
+    [[nodiscard]] Snapshot total() const noexcept {
+        Snapshot sum;
+        for (std::size_t i = 0; i < kAllocSiteCount; ++i) {
+            const auto snap = snapshot(static_cast<AllocSite>(i));
+            sum.count += snap.count;
+            sum.bytes += snap.bytes;
+        }
+        return sum;
+    }
+
+    /// Zero all counters (`stats reset`). Not atomic with respect to
+    /// concurrent record() calls; a handful of lost events is acceptable.
+    void reset() noexcept {
+        for (auto& counter : counters_) {
+            counter.count.store(0, std::memory_order_relaxed);
+            counter.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    AllocStats() = default;
+
+    struct Counter {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> bytes{0};
+    };
+    std::array<Counter, kAllocSiteCount> counters_{};
+};
+
+/// pmr resource decorator that attributes every allocation flowing through
+/// it to a site before forwarding upstream. Thread the REPL's AST arena
+/// through one of these and every parser node allocation is counted at the
+/// cost of two relaxed adds — the allocation itself still comes straight
+/// from the arena.
+class CountingMemoryResource final : public std::pmr::memory_resource {
+public:
+    CountingMemoryResource(std::pmr::memory_resource* upstream, AllocSite site) noexcept
+        : upstream_(upstream), site_(site) {}
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        AllocStats::instance().record(site_, bytes);
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        upstream_->deallocate(ptr, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    AllocSite site_;
+};
+
+}  // namespace wshell
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 #include <variant>
 
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <ostream>
@@ -16,12 +18,17 @@ namespace wshell {
 // Word struct for shell words (quoted, needs expansion, etc.)
 // ============================================================================
 
+// Word text is a handle into the interning pool (string_pool.hpp): the
+// Parser interns every word, so repeated words across lines share one
+// stable copy and the AST carries no owned strings. Callers constructing
+// Words by hand must pass text that outlives the node (string literals
+// and interned views both qualify).
 struct Word {
-    std::string text;
+    std::string_view text;
     bool quoted = false;
     bool needs_expansion = false;
-    Word(std::string t, bool q = false, bool n = false)
-        : text(std::move(t)), quoted(q), needs_expansion(n) {}
+    Word(std::string_view t, bool q = false, bool n = false)
+        : text(t), quoted(q), needs_expansion(n) {}
     Word() = default;
 };
 
@@ -59,10 +66,18 @@ struct AssignmentNode;
 struct CommandNode;
 struct PipelineNode;
 struct SequenceNode;
+struct ForNode;
+struct FunctionNode;
 
 // ============================================================================
 // AST Node Types (NO inheritance, NO base class)
 // ============================================================================
+//
+// Node vectors are pmr-backed so a whole parse can draw from one bump arena
+// (see Parser): default-constructed nodes still use the global heap, so
+// nothing changes for callers that build nodes by hand. Word text is an
+// interned view (see the Word comment above), so nodes carry no owned
+// word strings at all.
 
 struct CommentNode {
     std::string text;
@@ -73,35 +88,87 @@ struct AssignmentNode {
     std::string value;
 };
 
+/// Resolved dispatch route for a command name (see CommandNode::route)
+enum class CommandRoute : std::uint8_t {
+    Unresolved,  // not classified yet, or name needs per-execution expansion
+    Builtin,
+    Function,
+    External
+};
+
 struct CommandNode {
     Word command_name;
-    std::vector<Word> arguments;
-    std::vector<Redirection> redirections;
+    std::pmr::vector<Word> arguments;
+    std::pmr::vector<Redirection> redirections;
     bool background = false;
+
+    // Routing cache, filled by the interpreter on first execution. Plan-
+    // cached nodes execute many times, so remembering the resolved route
+    // (and the builtin or function body it resolved to) turns repeat
+    // dispatch into a switch with no string lookups. Only literal command
+    // names are cached; route_generation invalidates the entry when the
+    // interpreter's function table changes. Mutable because cached plans
+    // execute as const; valid while a single interpreter owns the plan
+    // (true for the REPL, which owns both the plan cache and the
+    // interpreter).
+    mutable CommandRoute route = CommandRoute::Unresolved;
+    mutable void* route_handle = nullptr;
+    mutable std::uint32_t route_generation = 0;
 };
 
 struct PipelineNode {
-    std::vector<CommandNode> commands;  // by value
+    std::pmr::vector<CommandNode> commands;  // by value
 };
 
 struct SequenceNode {
-    std::vector<std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode, SequenceNode>>
+    std::pmr::vector<std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode,
+                                  SequenceNode, ForNode, FunctionNode>>
         statements;
 };
 
+/// for VAR in WORD... [par [N]] do STATEMENT... done
+///
+/// `parallel` runs iterations concurrently over a bounded worker set (see
+/// ShellInterpreter::execute_for); max_jobs of 0 means hardware concurrency.
+struct ForNode {
+    std::string variable;
+    std::pmr::vector<Word> values;
+    std::pmr::vector<std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode,
+                                  SequenceNode, ForNode, FunctionNode>>
+        body;
+    bool parallel = false;
+    std::size_t max_jobs = 0;
+};
+
+/// function NAME do STATEMENT... done
+///
+/// Definitions register the body with the interpreter; invocation is an
+/// ordinary command whose name resolves through the function table (see
+/// ShellInterpreter::execute_command) with $1..$N bound to the arguments.
+struct FunctionNode {
+    std::string name;
+    std::pmr::vector<std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode,
+                                  SequenceNode, ForNode, FunctionNode>>
+        body;
+};
+
 // ============================================================================
 // Statement Variant (NO pointers)
 // ============================================================================
 
-using StatementNode =
-    std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode, SequenceNode>;
+using StatementNode = std::variant<CommentNode, AssignmentNode, CommandNode, PipelineNode,
+                                   SequenceNode, ForNode, FunctionNode>;
 
 // ============================================================================
 // Program Node
 // ============================================================================
 
 struct ProgramNode {
-    std::vector<StatementNode> statements;
+    std::pmr::vector<StatementNode> statements;
+
+    ProgramNode() = default;
+    /// Draw statement storage from the given arena (per-parse bump allocator)
+    explicit ProgramNode(std::pmr::memory_resource* arena) : statements(arena) {}
 
     void add_statement(StatementNode stmt) { statements.push_back(std::move(stmt)); }
 
@@ -121,16 +188,17 @@ inline AssignmentNode make_assignment(std::string var, std::string value) {
     return AssignmentNode{std::move(var), std::move(value)};
 }
 
-inline CommandNode make_command(Word name, std::vector<Word> args = {},
-                                std::vector<Redirection> redirs = {}, bool background = false) {
+inline CommandNode make_command(Word name, std::pmr::vector<Word> args = {},
+                                std::pmr::vector<Redirection> redirs = {},
+                                bool background = false) {
     return CommandNode{std::move(name), std::move(args), std::move(redirs), background};
 }
 
-inline PipelineNode make_pipeline(std::vector<CommandNode> cmds) {
+inline PipelineNode make_pipeline(std::pmr::vector<CommandNode> cmds) {
     return PipelineNode{std::move(cmds)};
 }
 
-inline SequenceNode make_sequence(std::vector<StatementNode> stmts) {
+inline SequenceNode make_sequence(std::pmr::vector<StatementNode> stmts) {
     return SequenceNode{std::move(stmts)};
 }
 
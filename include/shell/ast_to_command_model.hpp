@@ -12,7 +12,7 @@ namespace wshell {
 
 // Convert AST Word to command model ShellArg
 inline ShellArg ast_word_to_model(const Word& w) {
-    return ShellArg{w.text, w.quoted, w.needs_expansion};
+    return ShellArg{std::string(w.text), w.quoted, w.needs_expansion};
 }
 
 // Convert AST Redirection to command model IO (FileTarget)
@@ -30,12 +30,15 @@ inline IO ast_redir_to_model(const Redirection& r) {
             mode = OpenMode::WriteAppend;
             break;
     }
-    return FileTarget{r.target.text, mode};
+    return FileTarget{std::filesystem::path(r.target.text), mode};
 }
 
 // Convert AST CommandNode to command model Command
 inline Command ast_cmd_to_model(const CommandNode& node) {
     Command cmd;
+    // Lowered commands always describe external processes; builtins and
+    // functions dispatch in the interpreter before lowering
+    cmd.type = CommandType::External;
     cmd.executable = node.command_name.text;
     for (const auto& arg : node.arguments) {
         cmd.args.push_back(ast_word_to_model(arg));
@@ -52,4 +55,25 @@ inline Command ast_cmd_to_model(const CommandNode& node) {
     return cmd;
 }
 
+// Convert a whole PipelineNode into one executable Pipeline in a single
+// pass. `lower_stage` maps each CommandNode to a fully resolved Command
+// (expansion, glob, redirection attachment) or nullopt when the stage
+// cannot run as a spawned process — a builtin or function that must
+// dispatch in-process — in which case the lowering is abandoned and the
+// caller keeps its in-process path for the whole pipeline.
+template <typename LowerStage>
+[[nodiscard]] std::optional<Pipeline> ast_pipeline_to_model(const PipelineNode& node,
+                                                            LowerStage&& lower_stage) {
+    Pipeline pipeline;
+    pipeline.commands.reserve(node.commands.size());
+    for (const auto& stage : node.commands) {
+        auto cmd = lower_stage(stage);
+        if (!cmd) {
+            return std::nullopt;
+        }
+        pipeline.commands.push_back(std::move(*cmd));
+    }
+    return pipeline;
+}
+
 }  // namespace wshell
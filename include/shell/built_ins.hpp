@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -54,35 +55,147 @@ class KillBuiltin : public BuiltinFunction {
 // Forward declaration for History
 class History;
 
-// Implementation for 'history'
+// Implementation for 'history' (list entries; 'history search <pattern>'
+// runs an indexed substring query, see History::search)
 class HistoryBuiltin : public BuiltinFunction {
   public:
-    explicit HistoryBuiltin();
+    explicit HistoryBuiltin(History* history = nullptr) : history_(history) {}
     int invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) override;
 
+  private:
+    History* history_;
+};
+
+// Forward declaration for the job table (command_model.hpp)
+struct ExecutionContext;
+
+// Implementation for 'jobs' (list background jobs)
+class JobsBuiltin : public BuiltinFunction {
+  public:
+    explicit JobsBuiltin(ExecutionContext* exec_ctx) : exec_ctx_(exec_ctx) {}
+    int invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) override;
+
+  private:
+    ExecutionContext* exec_ctx_;
+};
+
+// Implementation for 'fg' (bring a background job to the foreground)
+class FgBuiltin : public BuiltinFunction {
+  public:
+    explicit FgBuiltin(ExecutionContext* exec_ctx) : exec_ctx_(exec_ctx) {}
+    int invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) override;
+
+  private:
+    ExecutionContext* exec_ctx_;
+};
+
+// Implementation for 'bg' (resume a stopped job in the background)
+class BgBuiltin : public BuiltinFunction {
+  public:
+    explicit BgBuiltin(ExecutionContext* exec_ctx) : exec_ctx_(exec_ctx) {}
+    int invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) override;
+
+  private:
+    ExecutionContext* exec_ctx_;
+};
+
+// Implementation for 'stats' (per-stage latency percentiles; `stats reset`
+// zeroes the histograms)
+class StatsBuiltin : public BuiltinFunction {
+  public:
+    int invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) override;
 };
 
 // Default built-in shell variables and their values
 static const std::unordered_map<std::string, std::string> builtinVariablesDefault = {
     {"PS1", "8=> "}, {"PS2", ": "}, {"HISTORY_SIZE", "100"}, {"SHELL", "/bin/wshell"}};
 
+// ============================================================================
+// Frozen builtin registry
+// ============================================================================
+//
+// The builtin name set is fixed at compile time, so dispatch does not need a
+// runtime hash map. Names live in one constexpr array sorted by name; lookup
+// is a branch-free-ish binary search over 9 entries (at most 4 comparisons),
+// takes string_view (no owning key construction at the call site), and
+// returns a dense index into a fixed dispatch array. Builtin instances are
+// value members of BuiltIns — constructing an interpreter performs no
+// registration-time heap allocation.
+
+/// Dense identifier for each builtin; indexes the dispatch array.
+enum class BuiltinId : std::size_t {
+    Bg, Cd, Exit, Fg, History, Jobs, Kill, Pwd, Stats,
+};
+
+inline constexpr std::size_t kBuiltinCount = 9;
+
+/// Frozen name table, sorted by name (kept in sync with BuiltinId by
+/// find_builtin_id's mapping below).
+inline constexpr std::array<std::pair<std::string_view, BuiltinId>, kBuiltinCount>
+    kBuiltinNames = {{
+        {"bg", BuiltinId::Bg},
+        {"cd", BuiltinId::Cd},
+        {"exit", BuiltinId::Exit},
+        {"fg", BuiltinId::Fg},
+        {"history", BuiltinId::History},
+        {"jobs", BuiltinId::Jobs},
+        {"kill", BuiltinId::Kill},
+        {"pwd", BuiltinId::Pwd},
+        {"stats", BuiltinId::Stats},
+    }};
+
+/// Single-probe lookup: name -> builtin id, or nullopt for external commands.
+[[nodiscard]] constexpr std::optional<BuiltinId>
+find_builtin_id(std::string_view name) noexcept {
+    std::size_t lo = 0;
+    std::size_t hi = kBuiltinNames.size();
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        const int cmp = kBuiltinNames[mid].first.compare(name);
+        if (cmp == 0) {
+            return kBuiltinNames[mid].second;
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return std::nullopt;
+}
+
+static_assert(find_builtin_id("cd") == BuiltinId::Cd);
+static_assert(find_builtin_id("stats") == BuiltinId::Stats);
+static_assert(!find_builtin_id("ls").has_value());
+
 class BuiltIns {
   public:
-    BuiltIns(History* history_ptr = nullptr) {
-        (void)history_ptr; // Suppress unused parameter warning (MSVC)
+    BuiltIns(History* history_ptr = nullptr, ExecutionContext* exec_ctx = nullptr)
+        : history_(history_ptr), jobs_(exec_ctx), fg_(exec_ctx), bg_(exec_ctx) {
         // Initialize built-in variable map with defaults
         builtinVariables_ = builtinVariablesDefault;
-        // Register builtin function implementations
-        builtinFunctionMap_["cd"] = std::make_unique<CdBuiltin>();
-        builtinFunctionMap_["pwd"] = std::make_unique<PwdBuiltin>();
-        builtinFunctionMap_["exit"] = std::make_unique<ExitBuiltin>();
-        builtinFunctionMap_["kill"] = std::make_unique<KillBuiltin>();
-        builtinFunctionMap_["history"] = std::make_unique<HistoryBuiltin>();
+        // Dispatch array indexed by BuiltinId; instances are members, so this
+        // is pointer assignment only
+        dispatch_[static_cast<std::size_t>(BuiltinId::Bg)] = &bg_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Cd)] = &cd_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Exit)] = &exit_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Fg)] = &fg_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::History)] = &history_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Jobs)] = &jobs_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Kill)] = &kill_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Pwd)] = &pwd_;
+        dispatch_[static_cast<std::size_t>(BuiltinId::Stats)] = &stats_;
+    }
 
+    /// Combined lookup: one probe, nullptr for non-builtins. This is the
+    /// call execute_command makes per command.
+    [[nodiscard]] BuiltinFunction* find(std::string_view cmd) const noexcept {
+        const auto id = find_builtin_id(cmd);
+        return id.has_value() ? dispatch_[static_cast<std::size_t>(*id)] : nullptr;
     }
 
-    [[nodiscard]] bool is_builtin_command(const std::string& cmd) const noexcept {
-        return builtinFunctionMap_.find(cmd) != builtinFunctionMap_.end();
+    [[nodiscard]] bool is_builtin_command(std::string_view cmd) const noexcept {
+        return find_builtin_id(cmd).has_value();
     }
 
     [[nodiscard]] std::optional<std::string>
@@ -98,16 +211,24 @@ class BuiltIns {
         builtinVariables_[var] = value;
     }
 
-    BuiltinFunction* get_builtin_function(const std::string& cmd) const {
-        auto it = builtinFunctionMap_.find(cmd);
-        if (it != builtinFunctionMap_.end()) {
-            return it->second.get();
-        }
-        return nullptr;
+    BuiltinFunction* get_builtin_function(std::string_view cmd) const noexcept {
+        return find(cmd);
     }
 
   private:
     std::unordered_map<std::string, std::string> builtinVariables_;
-    std::unordered_map<std::string, std::unique_ptr<BuiltinFunction>> builtinFunctionMap_;
+
+    // Builtin instances, owned by value (no per-instance heap allocation)
+    CdBuiltin cd_;
+    PwdBuiltin pwd_;
+    ExitBuiltin exit_;
+    KillBuiltin kill_;
+    HistoryBuiltin history_;
+    JobsBuiltin jobs_;
+    FgBuiltin fg_;
+    BgBuiltin bg_;
+    StatsBuiltin stats_;
+
+    std::array<BuiltinFunction*, kBuiltinCount> dispatch_{};
 };
 }  // namespace wshell
\ No newline at end of file
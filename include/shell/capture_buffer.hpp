@@ -0,0 +1,74 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// capture_buffer.hpp - Pooled byte buffers for CaptureTarget output
+//
+// Capturing a child's output grows a buffer from empty every time, so a
+// command-substitution-heavy script pays the same reallocation ramp on every
+// single capture. The pool keeps a few already-grown strings around: the
+// executor acquires one before draining the capture pipe, moves it into the
+// ExecutionResult, and whoever consumes the bytes hands the storage back via
+// release(). Steady-state captures then run with zero buffer reallocation.
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace wshell {
+
+class CaptureBufferPool {
+public:
+    /// First-use reservation: large enough that typical captured output
+    /// (command substitution results, tool version strings) never grows
+    static constexpr std::size_t INITIAL_RESERVE = 64 * 1024;
+
+    /// Retained buffer cap; beyond this, released storage is simply freed
+    static constexpr std::size_t MAX_POOLED = 8;
+
+    static CaptureBufferPool& instance() {
+        static CaptureBufferPool pool;
+        return pool;
+    }
+
+    /// Get an empty buffer, reusing pooled capacity when available
+    [[nodiscard]] std::string acquire() {
+        {
+            std::lock_guard lock(mutex_);
+            if (!pool_.empty()) {
+                std::string buffer = std::move(pool_.back());
+                pool_.pop_back();
+                return buffer;
+            }
+        }
+        std::string buffer;
+        buffer.reserve(INITIAL_RESERVE);
+        return buffer;
+    }
+
+    /// Return a buffer's storage to the pool (contents are discarded).
+    /// Safe to call with any string; callers that keep the bytes alive
+    /// simply never release.
+    void release(std::string&& buffer) {
+        buffer.clear();
+        std::lock_guard lock(mutex_);
+        if (pool_.size() < MAX_POOLED) {
+            pool_.push_back(std::move(buffer));
+        }
+    }
+
+    /// Number of buffers currently pooled (for tests/diagnostics)
+    [[nodiscard]] std::size_t pooled_count() {
+        std::lock_guard lock(mutex_);
+        return pool_.size();
+    }
+
+private:
+    CaptureBufferPool() = default;
+
+    std::mutex mutex_;
+    std::vector<std::string> pool_;
+};
+
+} // namespace wshell
@@ -68,6 +68,14 @@ struct InheritTarget {
 // Unified I/O endpoint for any stream.
 using IO = std::variant<InheritTarget, FileTarget, PipeTarget, CaptureTarget, NullTarget>;
 
+/// Command type classification (for execution routing and security)
+enum class CommandType {
+    Builtin,   // Built-in commands (cd, exit, export) - must run in shell process
+    External,  // External executables - can fork/exec
+    Function,  // User-defined shell functions
+    Alias      // Command aliases
+};
+
 struct Command {
     std::filesystem::path executable;  // absolute or relative; resolution is exec-layer policy
     std::optional<std::filesystem::path> work_dir;  // nullopt = inherit current working directory
@@ -87,6 +95,12 @@ struct Command {
     IO stdin_{InheritTarget{}};
     IO stdout_{InheritTarget{}};
     IO stderr_{InheritTarget{}};
+
+    // Classification assigned at lowering time (build_external_command,
+    // ast_cmd_to_model). Everything lowered to a Command today is an
+    // external process; builtins and functions dispatch in-process before
+    // lowering (see ShellInterpreter::execute_command).
+    CommandType type{CommandType::External};
 };
 
 // A pipeline is just an ordered list of commands.
@@ -145,15 +159,6 @@ inline IO inherit() {
 // EXTENDED MODEL - Control Structures, Job Control, and Runtime Context
 // ============================================================================
 
-/// Command type classification (for execution routing and security)
-enum class CommandType {
-    Builtin,   // Built-in commands (cd, exit, export) - must run in shell process
-    External,  // External executables - can fork/exec
-    Function,  // User-defined shell functions
-    Alias      // Command aliases
-};
-
-
 /// Job with runtime state (for job control: bg, fg, jobs commands)
 struct JobWithState {
     Job content;  // Command or Pipeline
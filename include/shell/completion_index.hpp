@@ -0,0 +1,209 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// completion_index.hpp - Prefix-completion index over $PATH and history
+//
+// Interactive completion has to answer while a key is held down, so the
+// index is built once — every $PATH directory is enumerated into a sorted,
+// deduplicated name array — and queries are a binary search plus a bounded
+// scan, not a directory walk. Each directory keeps its mtime from the scan;
+// refresh() re-stats the directories and rescans only the ones that
+// changed, so a package install updates the index without re-reading the
+// rest of $PATH. History lines feed a second sorted array (their first
+// word), merged at query time, so recently used commands complete even
+// when they are not on $PATH.
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace wshell {
+
+class CompletionIndex {
+public:
+    static constexpr std::size_t DEFAULT_MAX_RESULTS = 64;
+
+    /// Build the index from a PATH-style colon-separated directory list.
+    /// Unreadable or missing directories contribute nothing (and are
+    /// re-checked by refresh(), so they join the index if they appear).
+    explicit CompletionIndex(std::string_view path_value) {
+        std::size_t start = 0;
+        while (start <= path_value.size()) {
+            std::size_t end = path_value.find(':', start);
+            if (end == std::string_view::npos) {
+                end = path_value.size();
+            }
+            if (end > start) {
+                dirs_.push_back(DirSnapshot{
+                    std::filesystem::path(path_value.substr(start, end - start)), {}, {}});
+            }
+            start = end + 1;
+        }
+        for (auto& dir : dirs_) {
+            scan_dir(dir);
+        }
+        rebuild_merged();
+    }
+
+    /// Re-stat every directory and rescan only those whose mtime changed
+    /// (or that appeared/disappeared). Returns the number of directories
+    /// rescanned; 0 means the index was already fresh and no directory was
+    /// read.
+    std::size_t refresh() {
+        std::size_t rescanned = 0;
+        for (auto& dir : dirs_) {
+            std::error_code ec;
+            auto mtime = std::filesystem::last_write_time(dir.dir, ec);
+            if (ec) {
+                if (!dir.names.empty()) {
+                    dir.names.clear();
+                    dir.mtime = {};
+                    ++rescanned;
+                }
+                continue;
+            }
+            if (mtime != dir.mtime) {
+                scan_dir(dir);
+                ++rescanned;
+            }
+        }
+        if (rescanned != 0) {
+            rebuild_merged();
+        }
+        return rescanned;
+    }
+
+    /// Record an executed line: its first word becomes completable
+    void note_history(std::string_view line) {
+        std::size_t begin = line.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) {
+            return;
+        }
+        std::size_t end = line.find_first_of(" \t", begin);
+        std::string word(line.substr(begin, end == std::string_view::npos ? end : end - begin));
+        auto it = std::lower_bound(history_words_.begin(), history_words_.end(), word);
+        if (it == history_words_.end() || *it != word) {
+            history_words_.insert(it, std::move(word));
+        }
+    }
+
+    /// Bulk-load history lines (History::items()) through note_history
+    void merge_history(const std::vector<std::string>& lines) {
+        for (const auto& line : lines) {
+            note_history(line);
+        }
+    }
+
+    /// All completions beginning with `prefix`, lexicographically ordered
+    /// and deduplicated across the $PATH and history indexes, capped at
+    /// `max_results`. An empty prefix matches everything (up to the cap).
+    [[nodiscard]] std::vector<std::string>
+    complete(std::string_view prefix, std::size_t max_results = DEFAULT_MAX_RESULTS) const {
+        std::vector<std::string> out;
+        auto path_it = prefix_begin(commands_, prefix);
+        auto hist_it = prefix_begin(history_words_, prefix);
+
+        // Two-way sorted merge, stopping at the cap or when either range
+        // leaves the prefix
+        while (out.size() < max_results) {
+            const bool path_ok = path_it != commands_.end() && path_it->starts_with(prefix);
+            const bool hist_ok =
+                hist_it != history_words_.end() && hist_it->starts_with(prefix);
+            if (!path_ok && !hist_ok) {
+                break;
+            }
+            if (path_ok && hist_ok && *path_it == *hist_it) {
+                out.push_back(*path_it);
+                ++path_it;
+                ++hist_it;
+            } else if (!hist_ok || (path_ok && *path_it < *hist_it)) {
+                out.push_back(*path_it);
+                ++path_it;
+            } else {
+                out.push_back(*hist_it);
+                ++hist_it;
+            }
+        }
+        return out;
+    }
+
+    /// Exact-name membership test against the $PATH index (no history)
+    [[nodiscard]] bool contains_command(std::string_view name) const {
+        auto it = std::lower_bound(commands_.begin(), commands_.end(), name);
+        return it != commands_.end() && *it == name;
+    }
+
+    [[nodiscard]] std::size_t command_count() const noexcept { return commands_.size(); }
+    [[nodiscard]] std::size_t history_word_count() const noexcept {
+        return history_words_.size();
+    }
+    [[nodiscard]] std::size_t directory_count() const noexcept { return dirs_.size(); }
+
+private:
+    struct DirSnapshot {
+        std::filesystem::path dir;
+        std::filesystem::file_time_type mtime;
+        std::vector<std::string> names;  // executables found in this dir
+    };
+
+    static bool is_executable(const std::filesystem::directory_entry& entry) {
+        std::error_code ec;
+        if (!entry.is_regular_file(ec) || ec) {
+            return false;
+        }
+        auto perms = entry.status(ec).permissions();
+        if (ec) {
+            return false;
+        }
+        constexpr auto any_exec = std::filesystem::perms::owner_exec |
+                                  std::filesystem::perms::group_exec |
+                                  std::filesystem::perms::others_exec;
+        return (perms & any_exec) != std::filesystem::perms::none;
+    }
+
+    static void scan_dir(DirSnapshot& dir) {
+        dir.names.clear();
+        std::error_code ec;
+        dir.mtime = std::filesystem::last_write_time(dir.dir, ec);
+        if (ec) {
+            dir.mtime = {};
+            return;
+        }
+        for (std::filesystem::directory_iterator it(dir.dir, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            if (is_executable(*it)) {
+                dir.names.push_back(it->path().filename().string());
+            }
+        }
+    }
+
+    /// Merge every directory snapshot into one sorted, deduplicated array.
+    /// Rebuilding is O(total names log n) and only runs when a directory
+    /// actually changed; queries never pay for it.
+    void rebuild_merged() {
+        commands_.clear();
+        for (const auto& dir : dirs_) {
+            commands_.insert(commands_.end(), dir.names.begin(), dir.names.end());
+        }
+        std::sort(commands_.begin(), commands_.end());
+        commands_.erase(std::unique(commands_.begin(), commands_.end()), commands_.end());
+    }
+
+    static std::vector<std::string>::const_iterator
+    prefix_begin(const std::vector<std::string>& sorted, std::string_view prefix) {
+        return std::lower_bound(sorted.begin(), sorted.end(), prefix,
+                                [](const std::string& s, std::string_view p) {
+                                    return std::string_view(s) < p;
+                                });
+    }
+
+    std::vector<DirSnapshot> dirs_;       // per-directory scans with mtimes
+    std::vector<std::string> commands_;   // sorted, deduped merge of dirs_
+    std::vector<std::string> history_words_;  // sorted first-words of history
+};
+
+}  // namespace wshell
@@ -127,6 +127,19 @@ public:
 
     void showEnvironmentVariables();
 
+    /// @brief Load a config file through its compiled binary sidecar cache
+    /// @param source_path Path to the text config (e.g. ~/.wshellrc)
+    /// @return Expected with Config or ConfigError
+    /// @details The first parse serializes the validated variables to
+    ///          "<source>.cache", keyed by the source's size and mtime.
+    ///          Subsequent startups bulk-read the sidecar and skip parsing
+    ///          and validation entirely; a stale or malformed sidecar falls
+    ///          back to the text parse and is rewritten. Cache writes are
+    ///          best-effort (write to a temp file, then rename).
+    [[nodiscard]] static std::expected<Config, ConfigError> loadCached(
+        const std::filesystem::path& source_path
+    );
+
     /// @brief Convenience: Parse from string content
     /// @param content Configuration content in key=value format
     /// @return Expected with Config or ConfigError
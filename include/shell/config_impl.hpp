@@ -5,13 +5,143 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <ranges>
+#include <system_error>
 
 #include "config.hpp"
 
 
 namespace wshell {
 
+//==============================================================================
+// Binary Config Cache (sidecar for loadCached)
+//==============================================================================
+//
+// Compact serialization of an already-validated Variables map. The format is
+// not policy-dependent, so these helpers live outside the Config template.
+//
+//   magic u32 | version u32 | source_size u64 | source_mtime_ns i64 | count u64
+//   then per entry: name_len u32 | value_len u32 | name bytes | value bytes
+
+namespace config_cache_detail {
+
+inline constexpr std::uint32_t CACHE_MAGIC = 0x43485357;  // "WSHC"
+inline constexpr std::uint32_t CACHE_VERSION = 1;
+
+struct CacheHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t source_size;
+    std::int64_t source_mtime_ns;
+    std::uint64_t count;
+};
+
+[[nodiscard]] inline std::filesystem::path
+sidecar_path(const std::filesystem::path& source_path) {
+    auto path = source_path;
+    path += ".cache";
+    return path;
+}
+
+/// Read the sidecar if it matches the source's size/mtime key. Any mismatch,
+/// short read, or malformed entry returns nullopt so the caller re-parses.
+[[nodiscard]] inline std::optional<std::map<std::string, std::string>>
+try_read_cache(const std::filesystem::path& cache_path, std::uint64_t source_size,
+               std::int64_t source_mtime_ns) {
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in.is_open()) {
+        return std::nullopt;
+    }
+
+    CacheHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return std::nullopt;
+    }
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+        header.source_size != source_size || header.source_mtime_ns != source_mtime_ns) {
+        return std::nullopt;
+    }
+
+    // Entry counts and lengths come from an untrusted file; bound them
+    // against the bytes actually present so a corrupted sidecar can never
+    // force a multi-GB allocation — any violation falls back to re-parsing,
+    // like the magic/version checks above
+    std::error_code ec;
+    const auto cache_size = std::filesystem::file_size(cache_path, ec);
+    if (ec || cache_size < sizeof(CacheHeader)) {
+        return std::nullopt;
+    }
+    std::uint64_t remaining = cache_size - sizeof(CacheHeader);
+    constexpr std::uint64_t ENTRY_OVERHEAD = 2 * sizeof(std::uint32_t);
+    if (header.count > remaining / ENTRY_OVERHEAD) {
+        return std::nullopt;
+    }
+
+    std::map<std::string, std::string> variables;
+    for (std::uint64_t i = 0; i < header.count; ++i) {
+        std::uint32_t name_len = 0;
+        std::uint32_t value_len = 0;
+        if (!in.read(reinterpret_cast<char*>(&name_len), sizeof(name_len)) ||
+            !in.read(reinterpret_cast<char*>(&value_len), sizeof(value_len))) {
+            return std::nullopt;
+        }
+        remaining -= ENTRY_OVERHEAD;
+        if (name_len > remaining ||
+            value_len > remaining - name_len) {
+            return std::nullopt;
+        }
+        remaining -= std::uint64_t(name_len) + value_len;
+        std::string name(name_len, '\0');
+        std::string value(value_len, '\0');
+        if (!in.read(name.data(), static_cast<std::streamsize>(name_len)) ||
+            !in.read(value.data(), static_cast<std::streamsize>(value_len))) {
+            return std::nullopt;
+        }
+        variables.emplace(std::move(name), std::move(value));
+    }
+    return variables;
+}
+
+/// Best-effort cache write: temp file in the same directory, then rename so
+/// a concurrent reader never sees a half-written sidecar.
+inline void write_cache(const std::filesystem::path& cache_path, std::uint64_t source_size,
+                        std::int64_t source_mtime_ns,
+                        const std::map<std::string, std::string>& variables) {
+    auto tmp_path = cache_path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return;
+        }
+        const CacheHeader header{CACHE_MAGIC, CACHE_VERSION, source_size, source_mtime_ns,
+                                 variables.size()};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& [name, value] : variables) {
+            const auto name_len = static_cast<std::uint32_t>(name.size());
+            const auto value_len = static_cast<std::uint32_t>(value.size());
+            out.write(reinterpret_cast<const char*>(&name_len), sizeof(name_len));
+            out.write(reinterpret_cast<const char*>(&value_len), sizeof(value_len));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+            out.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+        if (!out) {
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, cache_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+    }
+}
+
+}  // namespace config_cache_detail
+
 //==============================================================================
 // Config Template Implementation
 //==============================================================================
@@ -41,6 +171,48 @@ Config<ValidationPolicy>::loadFromSource(IInputSource& source) {
 }
 
 
+template<typename ValidationPolicy>
+std::expected<Config<ValidationPolicy>, ConfigError>
+Config<ValidationPolicy>::loadCached(const std::filesystem::path& source_path) {
+    namespace cache = config_cache_detail;
+
+    // Cache key: source size + mtime. If either stat fails, go straight to
+    // the text path, which reports the real error.
+    std::error_code size_ec;
+    std::error_code mtime_ec;
+    const auto source_size = std::filesystem::file_size(source_path, size_ec);
+    const auto source_mtime = std::filesystem::last_write_time(source_path, mtime_ec);
+
+    const auto cache_path = cache::sidecar_path(source_path);
+
+    if (!size_ec && !mtime_ec) {
+        const auto mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  source_mtime.time_since_epoch())
+                                  .count();
+        if (auto cached = cache::try_read_cache(cache_path, source_size, mtime_ns)) {
+            // Fresh cache: the variables were validated when it was written,
+            // so skip parsing and validation entirely
+            Config config;
+            config.variables_ = std::move(*cached);
+            return config;
+        }
+
+        // Stale or missing cache: parse the text and rewrite the sidecar
+        FileInputSource source(source_path);
+        Config config;
+        auto parsed = config.loadFromSource(source);
+        if (!parsed) {
+            return parsed;
+        }
+        cache::write_cache(cache_path, source_size, mtime_ns, parsed->variables_);
+        return parsed;
+    }
+
+    FileInputSource source(source_path);
+    Config config;
+    return config.loadFromSource(source);
+}
+
 template<typename ValidationPolicy>
 std::expected<Config<ValidationPolicy>, ConfigError>
 Config<ValidationPolicy>::parse(std::string_view content) {
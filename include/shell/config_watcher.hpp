@@ -0,0 +1,189 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// config_watcher.hpp - Config hot-reload with atomic snapshot swap
+//
+// Long-lived orchestration shells hold warm caches (PATH resolution, plan
+// cache, env snapshots) that a restart throws away, so config changes must
+// land without one. The watcher keeps the current variables in an immutable
+// shared_ptr<const Variables> snapshot — the same copy-on-write discipline
+// as the executor's EnvironmentCache: readers pin the snapshot with a
+// refcount bump (no lock, no map copy) and a reader mid-command keeps the
+// snapshot it started with, so a reload can never produce a half-old,
+// half-new view. A background thread stats the file on an interval and
+// re-parses through Config::loadCached off the hot path when size or mtime
+// change; a failed parse keeps the previous snapshot. The mtime poll is the
+// portable watch primitive (one stat per interval, no platform branches);
+// the polling step is factored into poll_once() so tests drive reloads
+// deterministically without the thread.
+#pragma once
+
+#include "config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace wshell {
+
+class ConfigWatcher {
+public:
+    using Variables = DefaultConfig::Variables;
+    using Snapshot = std::shared_ptr<const Variables>;
+
+    static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{500};
+
+    /// Watch `path`, seeding the first snapshot by loading it (an absent
+    /// file seeds an empty snapshot and is picked up when it appears)
+    explicit ConfigWatcher(std::filesystem::path path,
+                           std::chrono::milliseconds poll_interval = DEFAULT_POLL_INTERVAL)
+        : path_(std::move(path)), poll_interval_(poll_interval) {
+        current_.store(std::make_shared<const Variables>(), std::memory_order_release);
+        note_stamp();
+        reload();
+    }
+
+    /// Watch `path` but seed from an already-loaded config, so startup
+    /// doesn't parse the same file twice
+    ConfigWatcher(std::filesystem::path path, Variables initial,
+                  std::chrono::milliseconds poll_interval = DEFAULT_POLL_INTERVAL)
+        : path_(std::move(path)), poll_interval_(poll_interval) {
+        current_.store(std::make_shared<const Variables>(std::move(initial)),
+                       std::memory_order_release);
+        note_stamp();
+    }
+
+    ~ConfigWatcher() { stop(); }
+
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    /// Pin the current snapshot: a refcount bump, valid for as long as the
+    /// caller holds it regardless of concurrent reloads
+    [[nodiscard]] Snapshot snapshot() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    /// One-shot lookup against the current snapshot
+    [[nodiscard]] std::optional<std::string> get(std::string_view key) const {
+        const auto snap = snapshot();
+        if (auto it = snap->find(std::string(key)); it != snap->end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    /// Start the background watch thread (idempotent)
+    void start() {
+        if (watcher_.joinable()) {
+            return;
+        }
+        stop_requested_ = false;
+        watcher_ = std::thread([this] { watch_loop(); });
+    }
+
+    /// Stop and join the watch thread (safe to call repeatedly)
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            stop_requested_ = true;
+        }
+        wake_.notify_all();
+        if (watcher_.joinable()) {
+            watcher_.join();
+        }
+    }
+
+    /// One polling step: stat the file and reload if its size or mtime
+    /// changed since the last check. Returns true when a new snapshot was
+    /// published. The watch thread calls this on the poll interval; tests
+    /// call it directly for deterministic reloads.
+    bool poll_once() {
+        const auto stamp = read_stamp();
+        if (stamp == last_stamp_) {
+            return false;
+        }
+        last_stamp_ = stamp;
+        return reload();
+    }
+
+    /// Number of snapshots published since construction (diagnostics/tests)
+    [[nodiscard]] std::uint64_t reload_count() const noexcept {
+        return reload_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Change detection key: (mtime, size), nullopt when the file is absent
+    using Stamp = std::optional<std::pair<std::filesystem::file_time_type, std::uintmax_t>>;
+
+    [[nodiscard]] Stamp read_stamp() const {
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(path_, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        const auto size = std::filesystem::file_size(path_, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        return std::make_pair(mtime, size);
+    }
+
+    void note_stamp() { last_stamp_ = read_stamp(); }
+
+    // Re-parse and publish. A vanished file publishes an empty snapshot; a
+    // parse error keeps the previous one (stale-but-consistent beats
+    // half-applied).
+    bool reload() {
+        std::error_code ec;
+        if (!std::filesystem::exists(path_, ec) || ec) {
+            publish(std::make_shared<const Variables>());
+            return true;
+        }
+        auto loaded = DefaultConfig::loadCached(path_);
+        if (!loaded) {
+            return false;
+        }
+        publish(std::make_shared<const Variables>(loaded->variables()));
+        return true;
+    }
+
+    void publish(Snapshot next) {
+        current_.store(std::move(next), std::memory_order_release);
+        reload_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void watch_loop() {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        while (!stop_requested_) {
+            if (wake_.wait_for(lock, poll_interval_, [this] { return stop_requested_; })) {
+                return;
+            }
+            lock.unlock();
+            (void)poll_once();
+            lock.lock();
+        }
+    }
+
+    std::filesystem::path path_;
+    std::chrono::milliseconds poll_interval_;
+    std::atomic<Snapshot> current_;
+    Stamp last_stamp_;
+    std::atomic<std::uint64_t> reload_count_{0};
+
+    std::thread watcher_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    bool stop_requested_{false};
+};
+
+}  // namespace wshell
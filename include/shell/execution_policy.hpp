@@ -6,6 +6,7 @@
 
 #include "command_model.hpp"
 #include <concepts>
+#include <expected>
 #include <vector>
 #include <optional>
 #include <string>
@@ -23,7 +24,15 @@ struct ExecutionResult {
     int error_code{0};
     int exit_code{0};
     std::optional<std::string> error_message;
-    
+
+    /// Bytes drained from CaptureTarget endpoints; empty when the
+    /// corresponding stream was not captured. The storage comes from
+    /// CaptureBufferPool — consumers may hand it back via release() once
+    /// the bytes are no longer needed.
+    std::string captured_stdout{};
+    std::string captured_stderr{};
+
+
     [[nodiscard]] bool is_success() const noexcept {
         return exit_code == platform::EXIT_SUCCESS_STATUS && !error_message.has_value();
     }
@@ -60,16 +69,34 @@ concept ExecutionPolicy = requires(T policy, const Command& cmd, const Pipeline&
 /// Platform-specific execution policy
 /// Implementation is in exec_posix.cpp (Linux/macOS) or exec_win32.cpp (Windows)
 struct PlatformExecutionPolicy {
-    [[nodiscard]] static std::vector<const char*> convertEnvironment(const Command& cmd);
     [[nodiscard]] static std::vector<const char*> convertArgv(const Command& cmd);
     /// Execute a single command
     ExecutionResult execute(const Command& cmd) const;
     
     /// Execute a pipeline
     ExecutionResult execute(const Pipeline& pipeline) const;
-    
-    /// Initialize job control (for interactive shells)
+
+    /// Launch a command without waiting for it (background jobs).
+    /// Returns the child process id; the caller owns reaping via try_wait().
+    [[nodiscard]] std::expected<platform::ProcessId, std::string>
+    execute_async(const Command& cmd) const;
+
+    /// Non-blocking check on a previously launched child: the result if it
+    /// has exited, std::nullopt while it is still running
+    [[nodiscard]] static std::optional<ExecutionResult> try_wait(platform::ProcessId pid);
+
+    /// Initialize job control (for interactive shells): own process group
+    /// plus a SIGCHLD handler that flags pending child exits
     void init_job_control() const;
+
+    /// True if a SIGCHLD arrived since the last call (consumes the flag).
+    /// Always true when init_job_control has not installed the handler, so
+    /// callers degrade to plain polling.
+    [[nodiscard]] static bool sigchld_pending();
+
+    /// Pre-warm the executable resolution cache with a one-time bulk $PATH
+    /// scan (optional; useful at interactive shell startup)
+    static void prescan_path();
 };
 
 // ============================================================================
@@ -86,14 +113,21 @@ struct FakeExecutionPolicy {
     // Configurable return values
     int return_code{platform::EXIT_SUCCESS_STATUS};
     std::optional<std::string> error_message;
-    
+    // Returned as captured_stdout when the command captures its stdout,
+    // letting tests exercise command substitution without real processes
+    std::string canned_stdout{};
+
     /// Execute a command (records it but doesn't actually execute)
     ExecutionResult execute(const Command& cmd) const {
         executed_commands.push_back(cmd);
-        return ExecutionResult{
+        ExecutionResult result{
             .exit_code = return_code,
             .error_message = error_message
         };
+        if (std::holds_alternative<CaptureTarget>(cmd.stdout_)) {
+            result.captured_stdout = canned_stdout;
+        }
+        return result;
     }
     
     /// Execute a pipeline (records it but doesn't actually execute)
@@ -109,6 +143,24 @@ struct FakeExecutionPolicy {
         };
     }
     
+    /// Launch without waiting (records it; completes instantly via try_wait)
+    [[nodiscard]] std::expected<platform::ProcessId, std::string>
+    execute_async(const Command& cmd) const {
+        executed_commands.push_back(cmd);
+        if (error_message.has_value()) {
+            return std::unexpected(*error_message);
+        }
+        return static_cast<platform::ProcessId>(10'000 + executed_commands.size());
+    }
+
+    /// Fake children are always already done
+    [[nodiscard]] std::optional<ExecutionResult> try_wait(platform::ProcessId /*pid*/) const {
+        return ExecutionResult{
+            .exit_code = return_code,
+            .error_message = error_message
+        };
+    }
+
     /// Initialize job control (no-op for fake)
     void init_job_control() const {
         // No-op
@@ -191,6 +243,17 @@ public:
         return policy_.execute(pipeline);
     }
     
+    /// Launch a command without waiting (background jobs)
+    [[nodiscard]] std::expected<platform::ProcessId, std::string>
+    execute_async(const Command& cmd) {
+        return policy_.execute_async(cmd);
+    }
+
+    /// Non-blocking completion check for an async launch
+    [[nodiscard]] std::optional<ExecutionResult> try_wait(platform::ProcessId pid) {
+        return policy_.try_wait(pid);
+    }
+
     /// Execute a job (Command or Pipeline variant)
     ExecutionResult execute(const Job& job) {
         return std::visit([this](const auto& item) {
@@ -0,0 +1,253 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// glob.hpp - Wildcard expansion with compiled patterns and cached listings
+//
+// Patterns are compiled once into an op array (literal bytes, '?', '*', and
+// pre-parsed '[...]' sets as 256-bit masks) and matched against thousands of
+// directory entries with an iterative star-backtracking loop — no per-
+// candidate re-interpretation of the pattern text. A GlobExpander carries a
+// directory-listing cache scoped to its lifetime: the interpreter creates
+// one per command line, so 'a/*.c b/*.c a/*.h' enumerates each directory
+// exactly once and the work is matcher-bound, not syscall-bound. Listing
+// goes through std::filesystem::directory_iterator, which sits on the
+// platform's bulk enumeration (getdents64 on Linux).
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace wshell {
+
+/// One compiled glob pattern segment: *, ?, [set] (with ranges and '!'/'^'
+/// negation), everything else literal. An unterminated '[' is a literal.
+class GlobPattern {
+public:
+    explicit GlobPattern(std::string_view pattern) {
+        ops_.reserve(pattern.size());
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            const char c = pattern[i];
+            if (c == '*') {
+                // Adjacent stars collapse to one
+                if (ops_.empty() || ops_.back().kind != OpKind::Star) {
+                    ops_.push_back({OpKind::Star, 0, 0});
+                }
+            } else if (c == '?') {
+                ops_.push_back({OpKind::AnyChar, 0, 0});
+            } else if (c == '[') {
+                std::size_t end = i;
+                if (auto set = parse_set(pattern, end)) {
+                    ops_.push_back(
+                        {OpKind::Set, 0, static_cast<std::uint32_t>(sets_.size())});
+                    sets_.push_back(*set);
+                    i = end;
+                } else {
+                    ops_.push_back({OpKind::Literal, c, 0});
+                }
+            } else {
+                ops_.push_back({OpKind::Literal, c, 0});
+            }
+        }
+    }
+
+    /// True when `s` contains unescaped glob metacharacters
+    [[nodiscard]] static bool contains_glob(std::string_view s) noexcept {
+        return s.find_first_of("*?[") != std::string_view::npos;
+    }
+
+    [[nodiscard]] bool match(std::string_view text) const noexcept {
+        // Classic iterative matcher: on mismatch after a star, rewind to
+        // the star and advance the text position it swallows
+        std::size_t op = 0;
+        std::size_t pos = 0;
+        std::size_t star_op = std::string_view::npos;
+        std::size_t star_pos = 0;
+
+        while (pos < text.size()) {
+            if (op < ops_.size() && matches_one(ops_[op], text[pos])) {
+                ++op;
+                ++pos;
+            } else if (op < ops_.size() && ops_[op].kind == OpKind::Star) {
+                star_op = op++;
+                star_pos = pos;
+            } else if (star_op != std::string_view::npos) {
+                op = star_op + 1;
+                pos = ++star_pos;
+            } else {
+                return false;
+            }
+        }
+        while (op < ops_.size() && ops_[op].kind == OpKind::Star) {
+            ++op;
+        }
+        return op == ops_.size();
+    }
+
+private:
+    enum class OpKind : std::uint8_t { Literal, AnyChar, Star, Set };
+    struct Op {
+        OpKind kind;
+        char literal;
+        std::uint32_t set_index;
+    };
+
+    [[nodiscard]] bool matches_one(const Op& op, char c) const noexcept {
+        switch (op.kind) {
+            case OpKind::Literal:
+                return op.literal == c;
+            case OpKind::AnyChar:
+                return true;
+            case OpKind::Set:
+                return sets_[op.set_index][static_cast<unsigned char>(c)];
+            case OpKind::Star:
+                return false;  // stars are handled by the backtracking loop
+        }
+        return false;
+    }
+
+    /// Parse "[...]" starting at pattern[start]; on success returns the
+    /// 256-bit membership mask and sets `end` to the closing ']'
+    static std::optional<std::bitset<256>> parse_set(std::string_view pattern,
+                                                     std::size_t& end) {
+        std::size_t i = end + 1;
+        bool negate = false;
+        if (i < pattern.size() && (pattern[i] == '!' || pattern[i] == '^')) {
+            negate = true;
+            ++i;
+        }
+        std::bitset<256> set;
+        bool first = true;
+        for (; i < pattern.size(); ++i, first = false) {
+            const char c = pattern[i];
+            if (c == ']' && !first) {
+                if (negate) {
+                    set.flip();
+                }
+                end = i;
+                return set;
+            }
+            // Range a-z (a trailing '-' is literal). Bounds widen to int so
+            // an upper bound of 0xFF terminates — ++ on unsigned char wraps
+            // 255 to 0 and would loop forever.
+            if (i + 2 < pattern.size() && pattern[i + 1] == '-' &&
+                pattern[i + 2] != ']') {
+                const int hi = static_cast<unsigned char>(pattern[i + 2]);
+                for (int b = static_cast<unsigned char>(c); b <= hi; ++b) {
+                    set.set(static_cast<std::size_t>(b));
+                }
+                i += 2;
+            } else {
+                set.set(static_cast<unsigned char>(c));
+            }
+        }
+        return std::nullopt;  // unterminated
+    }
+
+    std::vector<Op> ops_;
+    std::vector<std::bitset<256>> sets_;
+};
+
+/// Expands glob patterns against the filesystem with a directory-listing
+/// cache scoped to the expander's lifetime. Create one per command line so
+/// several patterns over the same directory share a single enumeration.
+class GlobExpander {
+public:
+    /// Expand one pattern into sorted matching paths. Dotfiles only match
+    /// segments that start with '.'; a pattern with no matches returns an
+    /// empty vector (callers pass the literal through, like bash without
+    /// nullglob). Globs may appear in any path segment.
+    [[nodiscard]] std::vector<std::string> expand(std::string_view pattern) {
+        const bool absolute = !pattern.empty() && pattern.front() == '/';
+        std::vector<std::string> candidates{absolute ? std::string("/")
+                                                     : std::string()};
+
+        std::size_t start = absolute ? 1 : 0;
+        while (start < pattern.size()) {
+            std::size_t end = pattern.find('/', start);
+            if (end == std::string_view::npos) {
+                end = pattern.size();
+            }
+            const std::string_view segment = pattern.substr(start, end - start);
+            start = end + 1;
+            if (segment.empty()) {
+                continue;
+            }
+
+            std::vector<std::string> next;
+            if (!GlobPattern::contains_glob(segment)) {
+                // Literal segment: extend every candidate; existence is
+                // checked once at the end
+                for (const auto& cand : candidates) {
+                    next.push_back(join(cand, segment));
+                }
+            } else {
+                GlobPattern matcher(segment);
+                for (const auto& cand : candidates) {
+                    for (const auto& name : list_dir(cand.empty() ? "." : cand)) {
+                        if (name.front() == '.' && segment.front() != '.') {
+                            continue;
+                        }
+                        if (matcher.match(name)) {
+                            next.push_back(join(cand, name));
+                        }
+                    }
+                }
+            }
+            candidates = std::move(next);
+            if (candidates.empty()) {
+                return {};
+            }
+        }
+
+        // Literal tail segments may name paths that don't exist
+        std::erase_if(candidates, [](const std::string& path) {
+            std::error_code ec;
+            return !std::filesystem::exists(std::filesystem::symlink_status(path, ec)) ||
+                   ec;
+        });
+        std::sort(candidates.begin(), candidates.end());
+        return candidates;
+    }
+
+    [[nodiscard]] std::size_t cached_directories() const noexcept {
+        return cache_.size();
+    }
+
+private:
+    [[nodiscard]] const std::vector<std::string>& list_dir(const std::string& dir) {
+        auto it = cache_.find(dir);
+        if (it != cache_.end()) {
+            return it->second;
+        }
+        std::vector<std::string> names;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator dit(dir, ec), end; !ec && dit != end;
+             dit.increment(ec)) {
+            names.push_back(dit->path().filename().string());
+        }
+        return cache_.emplace(dir, std::move(names)).first->second;
+    }
+
+    [[nodiscard]] static std::string join(const std::string& dir,
+                                          std::string_view name) {
+        if (dir.empty()) {
+            return std::string(name);
+        }
+        if (dir.back() == '/') {
+            return dir + std::string(name);
+        }
+        return dir + "/" + std::string(name);
+    }
+
+    std::unordered_map<std::string, std::vector<std::string>> cache_;
+};
+
+}  // namespace wshell
@@ -3,114 +3,319 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <unordered_map>
 #include <filesystem>
+#include <future>
 #include <ios>
 #include <algorithm>
 #include <cstddef>
 #include <utility>
 #include <ranges>
 #include <fstream>
-#include <iostream>
 #include <locale>
 
+#include "alloc_stats.hpp"
 #include "execution_policy.hpp"  // for get_home_directory
 
 constexpr size_t HISTORY_DEFAULT_SIZE = 1000;
 namespace wshell {
 
+// Shell command history backed by a fixed-capacity ring buffer: one
+// contiguous block with a head index, so push is O(1) even at capacity
+// (the oldest entry is simply overwritten in place).
 class History {
     using value_type = std::string;
 public:
 
     explicit History(std::size_t max_items = HISTORY_DEFAULT_SIZE)
-        : max_items_(max_items) {
-        history_.reserve(max_items);
-        //open and read from history
-        std::filesystem::path historyFile;
+        : max_items_(max_items == 0 ? HISTORY_DEFAULT_SIZE : max_items) {
+        buffer_.reserve(max_items_);
         auto path = get_home_directory_path();
         if ( path.has_value()) {
-            historyFile = std::filesystem::path(path.value()) / HISTORY_FILE;
+            history_path_ = std::filesystem::path(path.value()) / HISTORY_FILE;
         } else {
-            historyFile = std::filesystem::path(HISTORY_FILE);
+            history_path_ = std::filesystem::path(HISTORY_FILE);
         }
 
-        if (std::filesystem::exists(historyFile)) {
+        // Read the history file in the background so startup never blocks on
+        // it: the load overlaps with the user typing the first command and is
+        // merged in on first access (see ensure_loaded). A missing file is
+        // the normal first-run case, not an error — stay silent.
+        pending_load_ = std::async(std::launch::async, [file = history_path_] {
+            LoadResult result;
+            std::ifstream ifsHistory(file);
+            if (!ifsHistory.is_open()) {
+                return result;
+            }
+            result.file_existed = true;  // persistence requires an existing file
             std::string line;
-            std::ifstream ifsHistory(historyFile);
             while (std::getline(ifsHistory, line)) {
-                history_.push_back(line);
-                std::cout << line << std::endl;
+                result.lines.push_back(std::move(line));
             }
-            ifsHistory.close();
-        } else {
-            std::cerr << "Could not open history file." << std::endl;
-        }
+            return result;
+        });
     };
 
-    ~History() {
+    // Entries are appended to the history file as they are pushed, so there
+    // is nothing left to write at exit — just let the appender flush.
+    ~History() = default;
 
-        std::filesystem::path historyFile;
-        auto path = get_home_directory_path();
-        if ( path.has_value()) {
-            historyFile = std::filesystem::path(path.value()) / HISTORY_FILE;
-        } else {
-            historyFile = std::filesystem::path(HISTORY_FILE);
+    void set_max(std::size_t new_max) {
+        ensure_loaded();
+        if ( new_max == 0 ) {
+            new_max = HISTORY_DEFAULT_SIZE;
         }
 
-        if (std::filesystem::exists(historyFile)) {
-            std::ofstream ofsHistory(historyFile);
-            for (std::string line : history_) {
-                ofsHistory << line << std::endl;
-            }
-            ofsHistory.close();
-        } else {
-            std::cerr << "Could not open history file." << std::endl;
+        // Rotate oldest-first so the ring is linear, then trim in place
+        std::rotate(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(head_),
+                    buffer_.end());
+        head_ = 0;
+        if (buffer_.size() > new_max) {
+            buffer_.erase(buffer_.begin(),
+                          buffer_.end() - static_cast<std::ptrdiff_t>(new_max));
         }
+        buffer_.reserve(new_max);
+        max_items_ = new_max;
+        // Trimmed entries left stale postings behind; resizing is rare
+        // enough that a straight rebuild beats accounting for them
+        rebuild_index();
     }
 
-    void set_max(std::size_t new_max) {
-        if ( new_max == 0 ) {
-            new_max = HISTORY_DEFAULT_SIZE;
+    [[nodiscard]] std::size_t getMaxItems()  const noexcept { return max_items_; }
+    [[nodiscard]] std::size_t size() const { ensure_loaded(); return buffer_.size(); }
+    [[nodiscard]] bool empty() const { ensure_loaded(); return buffer_.empty(); }
+
+    /// Entry i in insertion order (0 = oldest)
+    [[nodiscard]] const value_type& item_at(std::size_t i) const {
+        ensure_loaded();
+        return buffer_[(head_ + i) % buffer_.size()];
+    }
+
+    /// All entries in insertion order, oldest first
+    [[nodiscard]] std::vector<value_type> items() const {
+        ensure_loaded();
+        std::vector<value_type> ordered;
+        ordered.reserve(buffer_.size());
+        for (std::size_t i = 0; i < buffer_.size(); ++i) {
+            ordered.push_back(item_at(i));
         }
-        
-        max_items_ = new_max;
+        return ordered;
+    }
 
-        const std::size_t n = (std::min)(max_items_, history_.size());
+    void push(value_type line) {
+        // Merge the file contents first so loaded entries stay oldest and
+        // this push both lands in the ring and reaches the appender
+        ensure_loaded();
+        push_entry(line);
+        append_to_file(line);
+    }
 
-        auto last_n_view = history_ | std::views::drop(history_.size() - n);
+    static constexpr std::size_t DEFAULT_SEARCH_RESULTS = 20;
 
-        std::vector<value_type> tmp;
-        tmp.reserve(max_items_);                 // capacity for future growth
-        tmp.assign(last_n_view.begin(), last_n_view.end());
+    /// Most-recent-first entries containing `pattern` as a substring.
+    /// Patterns of three or more bytes resolve through the trigram index
+    /// maintained on push: the rarest trigram's posting list is walked
+    /// newest-first and each candidate verified, so cost scales with the
+    /// number of matches, not the history size. Shorter patterns fall back
+    /// to a newest-first linear scan (the index cannot narrow them).
+    [[nodiscard]] std::vector<value_type>
+    search(std::string_view pattern,
+           std::size_t max_results = DEFAULT_SEARCH_RESULTS) const {
+        ensure_loaded();
+        std::vector<value_type> out;
+        if (pattern.empty() || buffer_.empty()) {
+            return out;
+        }
+        const Seq oldest = next_seq_ - buffer_.size();
 
-        history_.swap(tmp);                  // trims + releases old buffer
+        if (pattern.size() < NGRAM) {
+            for (std::size_t i = buffer_.size(); i-- > 0;) {
+                if (out.size() >= max_results) {
+                    break;
+                }
+                const auto& line = item_at(i);
+                if (line.find(pattern) != std::string::npos) {
+                    out.push_back(line);
+                }
+            }
+            return out;
+        }
+
+        // The rarest trigram of the pattern bounds the candidate set; a
+        // trigram the index has never seen means no entry can match
+        const std::vector<Seq>* rarest = nullptr;
+        for (std::size_t i = 0; i + NGRAM <= pattern.size(); ++i) {
+            auto it = trigrams_.find(trigram_key(pattern.data() + i));
+            if (it == trigrams_.end()) {
+                return out;
+            }
+            if (rarest == nullptr || it->second.size() < rarest->size()) {
+                rarest = &it->second;
+            }
+        }
+
+        // Posting lists are seq-ascending, so a reverse walk yields
+        // most-recent-first; everything below `oldest` was overwritten
+        for (auto it = rarest->rbegin(); it != rarest->rend(); ++it) {
+            if (*it < oldest) {
+                break;
+            }
+            if (out.size() >= max_results) {
+                break;
+            }
+            const auto& line = item_at(*it - oldest);
+            if (line.find(pattern) != std::string::npos) {
+                out.push_back(line);
+            }
+        }
+        return out;
     }
 
-    [[nodiscard]] std::size_t getMaxItems()  const noexcept { return max_items_; }
-    [[nodiscard]] std::size_t size() const noexcept { return history_.size(); }
-    [[nodiscard]] bool empty() const noexcept { return history_.empty(); }
 
-    [[nodiscard]] const std::vector<value_type>& items() const noexcept { return history_; }
 
-    void push(value_type line) {
-        if(history_.capacity() == history_.size()) {
-            std::vector<value_type> tmp;
-            tmp.reserve(max_items_);
-            std::move(history_.begin() + 1, history_.end(), tmp.begin());
-            history_.swap (tmp);
-            history_.push_back(line);
+private:
+
+    // What the background reader hands back on first access
+    struct LoadResult {
+        std::vector<value_type> lines;
+        bool file_existed{false};
+    };
+
+    // Merge the background file read into the ring on first access. Entries
+    // from the file are older than anything pushed this session, so they go
+    // in first. Logically const: callers observe a fully-loaded history
+    // either way, so the lazily-merged state is mutable.
+    void ensure_loaded() const {
+        if (!pending_load_.valid()) {
+            return;  // already merged (or moved-from)
+        }
+        LoadResult loaded = pending_load_.get();
+        persist_ = loaded.file_existed;
+        if (loaded.lines.empty()) {
+            return;
+        }
+        file_line_count_ += loaded.lines.size();
+        for (auto& line : loaded.lines) {
+            push_entry(std::move(line));
+        }
+    }
+
+    // O(1) ring insert: fill until capacity, then overwrite the oldest slot
+    // (const so the lazy merge can run from const accessors)
+    void push_entry(value_type line) const {
+        AllocStats::instance().record(AllocSite::History, line.size());
+        const Seq seq = next_seq_++;
+        if (buffer_.size() < max_items_) {
+            index_line(line, seq);
+            buffer_.push_back(std::move(line));
         } else {
-            history_.push_back(std::move(line));
+            // The overwritten line's postings go stale; an upper bound of
+            // its contribution feeds the compaction trigger below
+            const auto& old = buffer_[head_];
+            stale_postings_ += old.size() >= NGRAM ? old.size() - NGRAM + 1 : 0;
+            index_line(line, seq);
+            buffer_[head_] = std::move(line);
+            head_ = (head_ + 1) % max_items_;
+            if (stale_postings_ > live_postings_) {
+                rebuild_index();
+            }
         }
     }
 
+    // ------------------------------------------------------------------
+    // Trigram search index. Every pushed line adds one posting (its seq,
+    // a monotonically increasing push counter) to the list of each
+    // distinct trigram it contains; posting lists therefore stay sorted
+    // by construction. Entries evicted from the ring leave their postings
+    // behind as tombstones — search() skips seqs older than the oldest
+    // live entry, and the whole index is rebuilt from live entries once
+    // stale postings outnumber live ones, keeping memory proportional to
+    // the ring. Mutable for the same reason as the ring itself: the lazy
+    // file merge indexes from const accessors.
+    // ------------------------------------------------------------------
 
-    
-private:
+    static constexpr std::size_t NGRAM = 3;
+    using Seq = std::size_t;
+
+    static std::uint32_t trigram_key(const char* p) noexcept {
+        return (std::uint32_t(std::uint8_t(p[0])) << 16) |
+               (std::uint32_t(std::uint8_t(p[1])) << 8) |
+               std::uint32_t(std::uint8_t(p[2]));
+    }
 
+    void index_line(const value_type& line, Seq seq) const {
+        if (line.size() < NGRAM) {
+            return;
+        }
+        for (std::size_t i = 0; i + NGRAM <= line.size(); ++i) {
+            auto& postings = trigrams_[trigram_key(line.data() + i)];
+            // Repeated trigrams within one line collapse to one posting
+            if (postings.empty() || postings.back() != seq) {
+                postings.push_back(seq);
+                ++live_postings_;
+            }
+        }
+    }
+
+    void rebuild_index() const {
+        trigrams_.clear();
+        live_postings_ = 0;
+        stale_postings_ = 0;
+        const Seq oldest = next_seq_ - buffer_.size();
+        for (std::size_t i = 0; i < buffer_.size(); ++i) {
+            index_line(item_at(i), oldest + i);
+        }
+    }
+
+    // Incremental persistence: append each pushed command through a buffered
+    // appender so exit is O(1) and history survives a crash. When the file
+    // grows past twice max_items_, compact it down to the most recent
+    // in-memory entries.
+    void append_to_file(const value_type& line) {
+        if (!persist_) {
+            return;
+        }
+        if (!appender_.is_open()) {
+            appender_.open(history_path_, std::ios::out | std::ios::app);
+            if (!appender_) {
+                return;
+            }
+        }
+        appender_ << line << '\n';
+        ++file_line_count_;
+        if (file_line_count_ > max_items_ * 2) {
+            compact_file();
+        }
+    }
+
+    void compact_file() {
+        appender_.close();
+        std::ofstream rewritten(history_path_, std::ios::out | std::ios::trunc);
+        if (!rewritten) {
+            return;
+        }
+        for (std::size_t i = 0; i < buffer_.size(); ++i) {
+            rewritten << item_at(i) << '\n';
+        }
+        file_line_count_ = buffer_.size();
+    }
 
-    std::vector<value_type> history_;
+    // Ring state is mutable so ensure_loaded() can merge the background
+    // file read from logically-const accessors
+    mutable std::vector<value_type> buffer_;  // ring storage, contiguous
+    mutable std::size_t head_{0};             // index of the oldest entry
     std::size_t max_items_{HISTORY_DEFAULT_SIZE};
+    std::filesystem::path history_path_;
+    std::ofstream appender_;
+    mutable std::size_t file_line_count_{0};
+    mutable std::unordered_map<std::uint32_t, std::vector<Seq>> trigrams_;
+    mutable Seq next_seq_{0};
+    mutable std::size_t live_postings_{0};
+    mutable std::size_t stale_postings_{0};
+    mutable bool persist_{false};
+    mutable std::future<LoadResult> pending_load_;
     const char* HISTORY_FILE = "HISTORY";
 };
 
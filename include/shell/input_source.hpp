@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <expected>
 #include <filesystem>
 #include <istream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace wshell {
 
@@ -42,16 +46,38 @@ public:
 //==============================================================================
 
 /// @brief File-based input source with security checks
+/// @details The size cap is a per-instance policy (default 1MB, UNLIMITED to
+///          lift it). read_view() offers zero-copy ingestion by memory-mapping
+///          the file; the returned view stays valid for the life of the source.
 class FileInputSource final : public IInputSource {
 public:
-    explicit FileInputSource(std::filesystem::path path);
-    
+    /// Default size cap (1MB), kept from the original hard constant
+    static constexpr std::size_t DEFAULT_MAX_FILE_SIZE = 1'048'576;
+    /// Pass as max_file_size to disable the cap entirely
+    static constexpr std::size_t UNLIMITED = 0;
+
+    explicit FileInputSource(std::filesystem::path path,
+                             std::size_t max_file_size = DEFAULT_MAX_FILE_SIZE);
+    ~FileInputSource() override;
+
+    FileInputSource(const FileInputSource&) = delete;
+    FileInputSource& operator=(const FileInputSource&) = delete;
+
     [[nodiscard]] std::expected<std::string, std::string> read() override;
+
+    /// @brief Zero-copy read: memory-map the file and view it directly
+    /// @return View over the mapping (or an owned buffer on platforms
+    ///         without mmap), valid until this source is destroyed
+    [[nodiscard]] std::expected<std::string_view, std::string> read_view();
+
     [[nodiscard]] std::string source_name() const override;
 
 private:
     std::filesystem::path path_;
-    static constexpr std::size_t MAX_FILE_SIZE = 1'048'576;  // 1MB
+    std::size_t max_file_size_;
+    void* mapping_{nullptr};
+    std::size_t mapping_size_{0};
+    std::string fallback_content_;  // used where mmap is unavailable
 };
 
 /// @brief Stream-based input source (for stdin, testing, etc.)
@@ -69,6 +95,51 @@ private:
     static constexpr std::size_t MAX_STREAM_SIZE = 1'048'576;  // 1MB
 };
 
+/// @brief Decorator that reads ahead of the consumer on a background thread
+/// @details Wraps another source (non-owning, same pattern as
+///          BufferedOutputDestination) and keeps up to max_buffered_lines
+///          pulled ahead, so executing command N overlaps with the read for
+///          command N+1. Intended for pipe/file-fed batch input — the reader
+///          runs until EOF or error, so wrap interactive terminals only if a
+///          trailing blocked read at shutdown is acceptable
+///          (see platform stdin_is_interactive()).
+class ReadaheadInputSource final : public IInputSource {
+public:
+    static constexpr std::size_t DEFAULT_MAX_BUFFERED_LINES = 256;
+
+    explicit ReadaheadInputSource(IInputSource& inner,
+                                  std::size_t max_buffered_lines = DEFAULT_MAX_BUFFERED_LINES);
+    ~ReadaheadInputSource() override;
+
+    ReadaheadInputSource(const ReadaheadInputSource&) = delete;
+    ReadaheadInputSource& operator=(const ReadaheadInputSource&) = delete;
+
+    /// Whole-content reads bypass the line buffer entirely
+    [[nodiscard]] std::expected<std::string, std::string> read() override;
+
+    /// Pop the next buffered line, blocking until the reader has one.
+    /// After the inner source reports EOF/error, that result is sticky.
+    [[nodiscard]] std::expected<std::string, std::string> read_line() override;
+
+    [[nodiscard]] std::string source_name() const override;
+
+private:
+    void reader_loop();
+
+    IInputSource& inner_;
+    std::size_t max_buffered_lines_;
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<std::string> lines_;
+    std::string terminal_error_;  // inner EOF/error, reported after drain
+    bool done_{false};            // reader finished (terminal_error_ is set)
+    bool stop_{false};            // destructor asked the reader to quit
+
+    std::thread reader_;  // last member: starts after state is ready
+};
+
 /// @brief String-based input source (for testing and in-memory content)
 class StringInputSource final : public IInputSource {
 public:
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <optional>
@@ -37,20 +39,66 @@ enum class TokenType {
     Background,   // '&'
 };
 
-/// Token with type, value, and location
+/// Token with type, value, and location.
+/// The value is a view into the Lexer's source buffer (or static storage for
+/// operator lexemes), so tokens are cheap to copy and lexing never allocates.
+/// Consumers that need the text to outlive the source buffer must materialize
+/// it with std::string(token.value) — the parser does this when building AST
+/// nodes.
 struct Token {
     TokenType type;
-    std::string value;
+    std::string_view value;
     std::size_t line{1};
     std::size_t column{1};
-    
-    Token(TokenType t, std::string v = "", std::size_t ln = 1, std::size_t col = 1)
-        : type(t), value(std::move(v)), line(ln), column(col) {}
-    
+
+    Token(TokenType t, std::string_view v = {}, std::size_t ln = 1, std::size_t col = 1)
+        : type(t), value(v), line(ln), column(col) {}
+
     [[nodiscard]] bool is(TokenType t) const noexcept { return type == t; }
     [[nodiscard]] bool is_not(TokenType t) const noexcept { return type != t; }
 };
 
+// ============================================================================
+// TokenBuffer - Self-contained batch tokenization result
+// ============================================================================
+
+/// Result of Lexer::tokenize_buffer(): one contiguous token array plus one
+/// character pool holding a copy of the source text. Token values view into
+/// the pool, so the buffer is self-contained and independent of the caller's
+/// source lifetime. Exactly two allocations are made regardless of input size.
+/// Move-only: the pool is heap-allocated so moves never invalidate the views.
+class TokenBuffer {
+public:
+    TokenBuffer() = default;
+    TokenBuffer(TokenBuffer&&) noexcept = default;
+    TokenBuffer& operator=(TokenBuffer&&) noexcept = default;
+    TokenBuffer(const TokenBuffer&) = delete;
+    TokenBuffer& operator=(const TokenBuffer&) = delete;
+
+    [[nodiscard]] std::size_t size() const noexcept { return tokens_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return tokens_.empty(); }
+    [[nodiscard]] const Token& operator[](std::size_t index) const noexcept {
+        return tokens_[index];
+    }
+
+    [[nodiscard]] const std::vector<Token>& tokens() const noexcept { return tokens_; }
+
+    [[nodiscard]] auto begin() const noexcept { return tokens_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return tokens_.end(); }
+
+    /// The pooled copy of the source text the tokens view into
+    [[nodiscard]] std::string_view text() const noexcept {
+        return {pool_.get(), pool_size_};
+    }
+
+private:
+    friend class Lexer;
+
+    std::unique_ptr<char[]> pool_;
+    std::size_t pool_size_{0};
+    std::vector<Token> tokens_;
+};
+
 // ============================================================================
 // Lexer - Tokenizes input into tokens
 // ============================================================================
@@ -80,8 +128,15 @@ public:
         column_ = 1;
     }
     
-    /// Tokenize entire input into vector of tokens
+    /// Tokenize entire input into vector of tokens.
+    /// Token values view into `source`, which must outlive the returned vector.
     [[nodiscard]] static std::vector<Token> tokenize(std::string_view source);
+
+    /// Tokenize entire input into a self-contained TokenBuffer.
+    /// A counting pass sizes the token array exactly, so the result is built
+    /// with a single pair of allocations (token array + char pool) no matter
+    /// how large the input is.
+    [[nodiscard]] static TokenBuffer tokenize_buffer(std::string_view source);
     
 private:
     std::string_view source_;
@@ -99,7 +154,7 @@ private:
     [[nodiscard]] Token lex_comment();
     Token lex_word();
     [[nodiscard]] Token lex_identifier_or_keyword();
-    [[nodiscard]] Token make_token(TokenType type, std::string value = "");
+    [[nodiscard]] Token make_token(TokenType type, std::string_view value = {});
 };
 
 } // namespace wshell
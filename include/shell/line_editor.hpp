@@ -0,0 +1,633 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// line_editor.hpp - Raw-mode line editing with damage-tracked redraw
+//
+// The editor is split so the interesting logic never touches a terminal:
+// LineEditor is a pure byte-driven state machine (feed() decodes keystrokes
+// and escape sequences, mutates the edit buffer, and emits redraw bytes
+// through an IOutputDestination), which makes it testable against a
+// StringOutputDestination. LineEditorInputSource wraps it in termios raw
+// mode and a read(2) loop and slots into the REPL as an IInputSource.
+//
+// Redraw is damage-tracked: after every keystroke the editor diffs the
+// newly rendered frame (prompt + buffer) against the previous one and
+// emits only the changed tail — a cursor-column move, the differing
+// suffix, an erase-to-end when the line shrank, and a final cursor
+// reposition — batched into a single write per keystroke. Typing at the
+// end of the line therefore costs exactly one byte on the wire, which is
+// what keeps echo latency imperceptible over a high-RTT SSH link.
+//
+// Key bindings are pluggable: every decoded key dispatches through a
+// handler table that callers may override with bind(). The defaults wire
+// Tab to the CompletionIndex and Ctrl-R to History::search().
+#pragma once
+
+#include "completion_index.hpp"
+#include "history.hpp"
+#include "input_source.hpp"
+#include "output_destination.hpp"
+
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace wshell {
+
+/// Decoded keystroke identity used as the binding-table key. Printable
+/// bytes are not listed here — they self-insert unless explicitly bound.
+enum class Key : std::uint8_t {
+    Enter,
+    Tab,
+    Backspace,
+    Delete,
+    Up,
+    Down,
+    Left,
+    Right,
+    Home,
+    End,
+    CtrlA,
+    CtrlB,
+    CtrlC,
+    CtrlD,
+    CtrlE,
+    CtrlF,
+    CtrlK,
+    CtrlL,
+    CtrlR,
+    CtrlU,
+    CtrlW,
+};
+
+/// Byte-driven line editor with damage-tracked incremental redraw.
+/// Feed it input bytes; it maintains the edit buffer and emits minimal
+/// terminal updates (one batched write per keystroke) to the destination.
+class LineEditor {
+public:
+    enum class Status : std::uint8_t {
+        Editing,     ///< more bytes wanted
+        Submitted,   ///< Enter pressed; line() holds the result
+        EndOfInput,  ///< Ctrl-D on an empty line
+    };
+
+    using Handler = std::function<void(LineEditor&)>;
+
+    explicit LineEditor(IOutputDestination& out, std::string prompt = {})
+        : out_(out), prompt_(std::move(prompt)) {
+        install_default_bindings();
+    }
+
+    void set_prompt(std::string prompt) { prompt_ = std::move(prompt); }
+
+    /// Optional completion source for the Tab binding
+    void set_completion_index(CompletionIndex* index) noexcept { completion_ = index; }
+
+    /// Optional history for Up/Down navigation and Ctrl-R search
+    void set_history(const History* history) noexcept { history_ = history; }
+
+    /// Replace the handler for a decoded key (pluggable bindings)
+    void bind(Key key, Handler handler) { bindings_[key] = std::move(handler); }
+
+    /// Start a fresh line: clears the buffer and paints the prompt
+    void begin() {
+        buffer_.clear();
+        cursor_ = 0;
+        last_frame_.clear();
+        last_cursor_col_ = 0;
+        status_ = Status::Editing;
+        reset_history_nav();
+        reset_search();
+        redraw();
+    }
+
+    /// Process raw input bytes (any amount; escape sequences may split
+    /// across calls). Returns the editing status after the last byte.
+    Status feed(std::string_view bytes) {
+        for (const char byte : bytes) {
+            feed_byte(byte);
+            if (status_ != Status::Editing) {
+                break;
+            }
+        }
+        return status_;
+    }
+
+    [[nodiscard]] const std::string& line() const noexcept { return buffer_; }
+    [[nodiscard]] std::size_t cursor() const noexcept { return cursor_; }
+
+    //--------------------------------------------------------------------
+    // Editing primitives (public so custom bindings can drive them)
+    //--------------------------------------------------------------------
+
+    void insert_text(std::string_view text) {
+        buffer_.insert(cursor_, text);
+        cursor_ += text.size();
+        on_edit();
+    }
+
+    void delete_backward() {
+        if (cursor_ > 0) {
+            buffer_.erase(--cursor_, 1);
+            on_edit();
+        }
+    }
+
+    void delete_forward() {
+        if (cursor_ < buffer_.size()) {
+            buffer_.erase(cursor_, 1);
+            on_edit();
+        }
+    }
+
+    void move_left() {
+        if (cursor_ > 0) {
+            --cursor_;
+            redraw();
+        }
+    }
+
+    void move_right() {
+        if (cursor_ < buffer_.size()) {
+            ++cursor_;
+            redraw();
+        }
+    }
+
+    void move_home() {
+        cursor_ = 0;
+        redraw();
+    }
+
+    void move_end() {
+        cursor_ = buffer_.size();
+        redraw();
+    }
+
+    /// Kill from the cursor to the end of the line (Ctrl-K)
+    void kill_to_end() {
+        buffer_.erase(cursor_);
+        on_edit();
+    }
+
+    /// Kill the whole line (Ctrl-U)
+    void kill_line() {
+        buffer_.clear();
+        cursor_ = 0;
+        on_edit();
+    }
+
+    /// Delete the word before the cursor (Ctrl-W)
+    void kill_word_backward() {
+        std::size_t end = cursor_;
+        std::size_t start = end;
+        while (start > 0 && buffer_[start - 1] == ' ') {
+            --start;
+        }
+        while (start > 0 && buffer_[start - 1] != ' ') {
+            --start;
+        }
+        buffer_.erase(start, end - start);
+        cursor_ = start;
+        on_edit();
+    }
+
+    /// Replace the line with the previous (older) history entry
+    void history_prev() {
+        if (history_ == nullptr || history_->empty()) {
+            return;
+        }
+        if (!nav_offset_) {
+            pending_line_ = buffer_;  // stash the in-progress line
+            nav_offset_ = 0;
+        } else if (*nav_offset_ + 1 >= history_->size()) {
+            return;  // already at the oldest entry
+        } else {
+            ++*nav_offset_;
+        }
+        buffer_ = history_->item_at(history_->size() - 1 - *nav_offset_);
+        cursor_ = buffer_.size();
+        reset_search();
+        redraw();
+    }
+
+    /// Step back toward the newest entry; past it, restore the stash
+    void history_next() {
+        if (history_ == nullptr || !nav_offset_) {
+            return;
+        }
+        if (*nav_offset_ == 0) {
+            nav_offset_.reset();
+            buffer_ = std::move(pending_line_);
+        } else {
+            --*nav_offset_;
+            buffer_ = history_->item_at(history_->size() - 1 - *nav_offset_);
+        }
+        cursor_ = buffer_.size();
+        reset_search();
+        redraw();
+    }
+
+    /// Ctrl-R: substring-search history for the current line. The first
+    /// press captures the buffer as the pattern and jumps to the newest
+    /// match; repeated presses step to progressively older ones.
+    void history_search_step() {
+        if (history_ == nullptr) {
+            return;
+        }
+        if (!in_search_) {
+            search_pattern_ = buffer_;
+            search_matches_ = history_->search(search_pattern_);
+            search_pos_ = 0;
+            in_search_ = true;
+        } else if (search_pos_ + 1 < search_matches_.size()) {
+            ++search_pos_;
+        }
+        if (search_matches_.empty()) {
+            return;
+        }
+        buffer_ = search_matches_[search_pos_];
+        cursor_ = buffer_.size();
+        reset_history_nav();
+        redraw();
+    }
+
+    /// Tab: complete the word under the cursor via the CompletionIndex.
+    /// A unique extension is inserted in place; an ambiguous one extends
+    /// to the longest common prefix, and if that adds nothing the
+    /// candidates are listed below the line (then the frame is repainted).
+    void complete_word() {
+        if (completion_ == nullptr) {
+            return;
+        }
+        std::size_t word_start = cursor_;
+        while (word_start > 0 && buffer_[word_start - 1] != ' ') {
+            --word_start;
+        }
+        const std::string_view word =
+            std::string_view(buffer_).substr(word_start, cursor_ - word_start);
+        const auto candidates = completion_->complete(word);
+        if (candidates.empty()) {
+            return;
+        }
+
+        std::string_view common = candidates.front();
+        for (const auto& candidate : candidates) {
+            std::size_t i = 0;
+            while (i < common.size() && i < candidate.size() &&
+                   common[i] == candidate[i]) {
+                ++i;
+            }
+            common = common.substr(0, i);
+        }
+
+        if (common.size() > word.size()) {
+            insert_text(common.substr(word.size()));
+            return;
+        }
+
+        // No extension possible: show the choices and repaint the line.
+        // The listing and the repaint still go out as one write.
+        std::string listing = "\r\n";
+        for (const auto& candidate : candidates) {
+            listing += candidate;
+            listing += "  ";
+        }
+        listing += "\r\n";
+        last_frame_.clear();
+        last_cursor_col_ = 0;
+        redraw(listing);
+    }
+
+    /// Accept the line (Enter)
+    void accept_line() {
+        emit("\r\n");
+        status_ = Status::Submitted;
+    }
+
+    /// Ctrl-C: discard the line and start over on a fresh row
+    void cancel_line() {
+        buffer_.clear();
+        cursor_ = 0;
+        reset_history_nav();
+        reset_search();
+        last_frame_.clear();
+        last_cursor_col_ = 0;
+        redraw("^C\r\n");
+    }
+
+    /// Ctrl-L: clear the screen and repaint the current line at the top
+    void clear_screen() {
+        last_frame_.clear();
+        last_cursor_col_ = 0;
+        redraw("\x1b[H\x1b[2J");
+    }
+
+private:
+    // Escape-sequence decoder state: a plain ESC may be the start of a
+    // CSI sequence whose bytes arrive in later feed() calls
+    enum class EscState : std::uint8_t { None, Escape, Csi };
+
+    void install_default_bindings() {
+        bind(Key::Enter, [](LineEditor& ed) { ed.accept_line(); });
+        bind(Key::Tab, [](LineEditor& ed) { ed.complete_word(); });
+        bind(Key::Backspace, [](LineEditor& ed) { ed.delete_backward(); });
+        bind(Key::Delete, [](LineEditor& ed) { ed.delete_forward(); });
+        bind(Key::Up, [](LineEditor& ed) { ed.history_prev(); });
+        bind(Key::Down, [](LineEditor& ed) { ed.history_next(); });
+        bind(Key::Left, [](LineEditor& ed) { ed.move_left(); });
+        bind(Key::Right, [](LineEditor& ed) { ed.move_right(); });
+        bind(Key::Home, [](LineEditor& ed) { ed.move_home(); });
+        bind(Key::End, [](LineEditor& ed) { ed.move_end(); });
+        bind(Key::CtrlA, [](LineEditor& ed) { ed.move_home(); });
+        bind(Key::CtrlB, [](LineEditor& ed) { ed.move_left(); });
+        bind(Key::CtrlC, [](LineEditor& ed) { ed.cancel_line(); });
+        bind(Key::CtrlE, [](LineEditor& ed) { ed.move_end(); });
+        bind(Key::CtrlF, [](LineEditor& ed) { ed.move_right(); });
+        bind(Key::CtrlK, [](LineEditor& ed) { ed.kill_to_end(); });
+        bind(Key::CtrlL, [](LineEditor& ed) { ed.clear_screen(); });
+        bind(Key::CtrlR, [](LineEditor& ed) { ed.history_search_step(); });
+        bind(Key::CtrlU, [](LineEditor& ed) { ed.kill_line(); });
+        bind(Key::CtrlW, [](LineEditor& ed) { ed.kill_word_backward(); });
+        bind(Key::CtrlD, [](LineEditor& ed) {
+            if (ed.buffer_.empty()) {
+                ed.emit("\r\n");
+                ed.status_ = Status::EndOfInput;
+            } else {
+                ed.delete_forward();
+            }
+        });
+    }
+
+    void feed_byte(char byte) {
+        if (esc_state_ == EscState::Escape) {
+            esc_state_ = (byte == '[') ? EscState::Csi : EscState::None;
+            return;
+        }
+        if (esc_state_ == EscState::Csi) {
+            if (byte >= '0' && byte <= '9') {
+                csi_param_ = csi_param_ * 10 + (byte - '0');
+                return;
+            }
+            esc_state_ = EscState::None;
+            decode_csi(byte);
+            return;
+        }
+        switch (byte) {
+            case '\x1b':
+                esc_state_ = EscState::Escape;
+                csi_param_ = 0;
+                return;
+            case '\r':
+            case '\n': dispatch(Key::Enter); return;
+            case '\t': dispatch(Key::Tab); return;
+            case 0x7f:
+            case '\b': dispatch(Key::Backspace); return;
+            case 0x01: dispatch(Key::CtrlA); return;
+            case 0x02: dispatch(Key::CtrlB); return;
+            case 0x03: dispatch(Key::CtrlC); return;
+            case 0x04: dispatch(Key::CtrlD); return;
+            case 0x05: dispatch(Key::CtrlE); return;
+            case 0x06: dispatch(Key::CtrlF); return;
+            case 0x0b: dispatch(Key::CtrlK); return;
+            case 0x0c: dispatch(Key::CtrlL); return;
+            case 0x12: dispatch(Key::CtrlR); return;
+            case 0x15: dispatch(Key::CtrlU); return;
+            case 0x17: dispatch(Key::CtrlW); return;
+            default:
+                if (static_cast<unsigned char>(byte) >= 0x20) {
+                    reset_history_nav();
+                    reset_search();
+                    insert_text(std::string_view(&byte, 1));
+                }
+                return;
+        }
+    }
+
+    void decode_csi(char final_byte) {
+        switch (final_byte) {
+            case 'A': dispatch(Key::Up); return;
+            case 'B': dispatch(Key::Down); return;
+            case 'C': dispatch(Key::Right); return;
+            case 'D': dispatch(Key::Left); return;
+            case 'H': dispatch(Key::Home); return;
+            case 'F': dispatch(Key::End); return;
+            case '~':
+                if (csi_param_ == 1 || csi_param_ == 7) {
+                    dispatch(Key::Home);
+                } else if (csi_param_ == 3) {
+                    dispatch(Key::Delete);
+                } else if (csi_param_ == 4 || csi_param_ == 8) {
+                    dispatch(Key::End);
+                }
+                return;
+            default: return;  // unrecognized sequences are swallowed
+        }
+    }
+
+    void dispatch(Key key) {
+        // Anything except Ctrl-R leaves search mode; anything except
+        // Up/Down leaves history navigation
+        if (key != Key::CtrlR) {
+            reset_search();
+        }
+        if (key != Key::Up && key != Key::Down) {
+            reset_history_nav();
+        }
+        if (auto it = bindings_.find(key); it != bindings_.end()) {
+            it->second(*this);
+        }
+    }
+
+    void on_edit() {
+        reset_history_nav();
+        reset_search();
+        redraw();
+    }
+
+    /// Diff the rendered frame against the previous one and emit only the
+    /// damage, optionally preceded by a preamble (candidate listing,
+    /// clear-screen), as a single batched write.
+    void redraw(std::string_view preamble = {}) {
+        std::string frame = prompt_ + buffer_;
+        const std::size_t cursor_col = prompt_.size() + cursor_;
+
+        std::size_t diff = 0;
+        while (diff < frame.size() && diff < last_frame_.size() &&
+               frame[diff] == last_frame_[diff]) {
+            ++diff;
+        }
+
+        std::string update(preamble);
+        if (diff != frame.size() || diff != last_frame_.size()) {
+            std::size_t col = last_cursor_col_;
+            if (col != diff) {
+                update += column_to(diff);
+                col = diff;
+            }
+            update += std::string_view(frame).substr(diff);
+            col = frame.size();
+            if (frame.size() < last_frame_.size()) {
+                update += "\x1b[K";  // erase the stale tail
+            }
+            if (col != cursor_col) {
+                update += column_to(cursor_col);
+            }
+        } else if (cursor_col != last_cursor_col_) {
+            update += column_to(cursor_col);
+        }
+
+        last_frame_ = std::move(frame);
+        last_cursor_col_ = cursor_col;
+        if (!update.empty()) {
+            emit(update);
+        }
+    }
+
+    /// Absolute cursor-column addressing (CHA); columns are 1-based
+    [[nodiscard]] static std::string column_to(std::size_t col) {
+        return "\x1b[" + std::to_string(col + 1) + "G";
+    }
+
+    void emit(std::string_view bytes) {
+        (void)out_.write(bytes);
+        (void)out_.flush();  // raw mode bypasses stdio's tty line buffering
+    }
+
+    void reset_history_nav() {
+        nav_offset_.reset();
+        pending_line_.clear();
+    }
+
+    void reset_search() {
+        in_search_ = false;
+        search_matches_.clear();
+        search_pos_ = 0;
+        search_pattern_.clear();
+    }
+
+    IOutputDestination& out_;
+    std::string prompt_;
+    std::string buffer_;
+    std::size_t cursor_{0};
+    Status status_{Status::Editing};
+
+    // Damage tracking: last rendered frame and where the cursor was left
+    std::string last_frame_;
+    std::size_t last_cursor_col_{0};
+
+    EscState esc_state_{EscState::None};
+    int csi_param_{0};
+
+    std::unordered_map<Key, Handler> bindings_;
+    CompletionIndex* completion_{nullptr};
+    const History* history_{nullptr};
+
+    // History navigation (Up/Down): offset from the newest entry, plus
+    // the stashed in-progress line restored when stepping past it
+    std::optional<std::size_t> nav_offset_;
+    std::string pending_line_;
+
+    // Ctrl-R search state
+    bool in_search_{false};
+    std::vector<std::string> search_matches_;
+    std::size_t search_pos_{0};
+    std::string search_pattern_;
+};
+
+#if !defined(_WIN32)
+
+/// RAII termios raw mode: keystrokes arrive unbuffered and unechoed for
+/// the guard's lifetime, and the terminal is restored on scope exit
+class RawModeGuard {
+public:
+    explicit RawModeGuard(int fd) : fd_(fd) {
+        if (::tcgetattr(fd_, &saved_) != 0) {
+            return;
+        }
+        termios raw = saved_;
+        raw.c_iflag &= ~static_cast<tcflag_t>(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+        raw.c_oflag &= ~static_cast<tcflag_t>(OPOST);
+        raw.c_lflag &= ~static_cast<tcflag_t>(ECHO | ICANON | IEXTEN | ISIG);
+        raw.c_cc[VMIN] = 1;   // block for at least one byte
+        raw.c_cc[VTIME] = 0;  // no inter-byte timeout
+        active_ = (::tcsetattr(fd_, TCSAFLUSH, &raw) == 0);
+    }
+
+    ~RawModeGuard() {
+        if (active_) {
+            (void)::tcsetattr(fd_, TCSAFLUSH, &saved_);
+        }
+    }
+
+    RawModeGuard(const RawModeGuard&) = delete;
+    RawModeGuard& operator=(const RawModeGuard&) = delete;
+
+    [[nodiscard]] bool active() const noexcept { return active_; }
+
+private:
+    int fd_;
+    termios saved_{};
+    bool active_{false};
+};
+
+/// Interactive input source backed by the line editor: read_line() runs
+/// the terminal in raw mode and feeds keystrokes to the editor until a
+/// line is accepted. Drop-in replacement for StreamInputSource in the
+/// REPL when stdin is a tty.
+class LineEditorInputSource final : public IInputSource {
+public:
+    explicit LineEditorInputSource(IOutputDestination& out, int fd = STDIN_FILENO)
+        : editor_(out), fd_(fd) {}
+
+    [[nodiscard]] LineEditor& editor() noexcept { return editor_; }
+
+    void set_prompt(std::string prompt) { editor_.set_prompt(std::move(prompt)); }
+
+    [[nodiscard]] std::expected<std::string, std::string> read() override {
+        return read_line();
+    }
+
+    [[nodiscard]] std::expected<std::string, std::string> read_line() override {
+        RawModeGuard raw(fd_);
+        editor_.begin();
+        char buf[64];
+        while (true) {
+            const ssize_t n = ::read(fd_, buf, sizeof(buf));
+            if (n < 0) {
+                return std::unexpected("Error reading from terminal");
+            }
+            if (n == 0) {
+                return std::unexpected("End of input");
+            }
+            switch (editor_.feed(std::string_view(buf, static_cast<std::size_t>(n)))) {
+                case LineEditor::Status::Submitted:
+                    return editor_.line();
+                case LineEditor::Status::EndOfInput:
+                    return std::unexpected("End of input");
+                case LineEditor::Status::Editing:
+                    break;
+            }
+        }
+    }
+
+    [[nodiscard]] std::string source_name() const override { return "terminal"; }
+
+private:
+    LineEditor editor_;
+    int fd_;
+};
+
+#endif  // !defined(_WIN32)
+
+}  // namespace wshell
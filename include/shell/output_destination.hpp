@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <memory>
 #include <ostream>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -31,7 +32,22 @@ public:
     /// @brief Flush any buffered output
     /// @return Expected with void or error message
     [[nodiscard]] virtual std::expected<void, std::string> flush() = 0;
-    
+
+    /// @brief Scatter/gather write: emit several pieces as one logical write
+    /// @details Default implementation loops over write(); fd-backed
+    ///          destinations override this to issue a single writev().
+    /// @param pieces Pieces to write, in order
+    /// @return Expected with void or error message
+    [[nodiscard]] virtual std::expected<void, std::string>
+    write_many(std::span<const std::string_view> pieces) {
+        for (auto piece : pieces) {
+            if (auto result = write(piece); !result) {
+                return result;
+            }
+        }
+        return {};
+    }
+
     /// @brief Get destination identifier (for error reporting)
     [[nodiscard]] virtual std::string destination_name() const = 0;
 };
@@ -94,4 +110,57 @@ private:
     std::unique_ptr<std::ostream> stream_;
 };
 
+/// @brief Buffering decorator over any output destination
+/// @details Collects small writes (prompt fragments, error pieces, newlines)
+///          into an internal chunk buffer and forwards them to the wrapped
+///          destination only when the chunk fills or flush() is called, so a
+///          REPL iteration costs a handful of downstream writes instead of
+///          one per fragment. Does not own the wrapped destination.
+class BufferedOutputDestination final : public IOutputDestination {
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 4096;
+
+    explicit BufferedOutputDestination(IOutputDestination& inner,
+                                       std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+    ~BufferedOutputDestination() override;
+
+    BufferedOutputDestination(const BufferedOutputDestination&) = delete;
+    BufferedOutputDestination& operator=(const BufferedOutputDestination&) = delete;
+
+    [[nodiscard]] std::expected<void, std::string> write(std::string_view content) override;
+    [[nodiscard]] std::expected<void, std::string> flush() override;
+    [[nodiscard]] std::expected<void, std::string>
+    write_many(std::span<const std::string_view> pieces) override;
+    [[nodiscard]] std::string destination_name() const override;
+
+private:
+    /// Hand the buffered chunk to the wrapped destination (without flushing it)
+    [[nodiscard]] std::expected<void, std::string> drain();
+
+    IOutputDestination& inner_;
+    std::string buffer_;
+    std::size_t chunk_size_;
+};
+
+#ifndef _WIN32
+/// @brief File-descriptor-backed output destination (stdout/stderr, pipes)
+/// @details Writes through the raw fd, bypassing stdio buffering; write_many()
+///          maps directly to writev() so a batch of fragments costs one
+///          syscall. The descriptor is borrowed, not owned.
+class FdOutputDestination final : public IOutputDestination {
+public:
+    explicit FdOutputDestination(int fd, std::string name = "fd");
+
+    [[nodiscard]] std::expected<void, std::string> write(std::string_view content) override;
+    [[nodiscard]] std::expected<void, std::string> flush() override;
+    [[nodiscard]] std::expected<void, std::string>
+    write_many(std::span<const std::string_view> pieces) override;
+    [[nodiscard]] std::string destination_name() const override;
+
+private:
+    int fd_;
+    std::string name_;
+};
+#endif
+
 } // namespace shell
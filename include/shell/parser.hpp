@@ -3,19 +3,25 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
 #include <expected>
-#include <iostream>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <source_location>
+#include <vector>
 
 #include "ast.hpp"
-#include "ast_printer.hpp"
 #include "lexer.hpp"
+#include "stage_stats.hpp"
 
 namespace wshell {
 
+class IOutputDestination;
+
 enum class ParseErrorKind {
     SyntaxError,
     IncompleteInput
@@ -52,9 +58,21 @@ struct ParseError {
 ///   Command    := Identifier Identifier*
 class Parser {
 public:
-    /// Construct parser with input source
-    explicit Parser(std::string_view source, bool /*repl_mode*/ = true)
-        : lexer_(source) {}
+    /// Construct parser with input source. `arena` backs every AST vector
+    /// built during this parse (pass a monotonic_buffer_resource and reset
+    /// it after execution to turn per-line AST churn into a pointer bump);
+    /// the default is the global heap, preserving standalone behaviour.
+    explicit Parser(std::string_view source, bool /*repl_mode*/ = true,
+                    std::pmr::memory_resource* arena = std::pmr::get_default_resource())
+        : lexer_(source), arena_(arena) {}
+
+    /// Construct parser over an already-lexed token stream (used by
+    /// ParserSession so continuation lines don't re-lex earlier input).
+    /// The tokens must outlive the parser; a missing trailing EndOfFile is
+    /// synthesized.
+    explicit Parser(std::span<const Token> tokens,
+                    std::pmr::memory_resource* arena = std::pmr::get_default_resource())
+        : lexer_(std::string_view{}), arena_(arena), tokens_(tokens), token_mode_(true) {}
 
     /// Parse the entire program
     [[nodiscard]] std::expected<std::unique_ptr<ProgramNode>, ParseError>
@@ -64,8 +82,26 @@ public:
     [[nodiscard]] std::expected<std::unique_ptr<ProgramNode>, ParseError>
     parse_line();
 
+    /// Streaming interface: parse and return the next statement using the
+    /// parse_program grammar, or nullopt at clean end of input. Lets script
+    /// execution interleave with parsing instead of materializing the whole
+    /// AST up front.
+    [[nodiscard]] std::expected<std::optional<StatementNode>, ParseError>
+    parse_next_statement();
+
 private:
     Lexer lexer_;
+    std::pmr::memory_resource* arena_;
+
+    // Token-stream mode (second constructor): tokens come from tokens_ via
+    // cursor_ instead of pulling from lexer_
+    std::span<const Token> tokens_{};
+    std::size_t cursor_{0};
+    bool token_mode_{false};
+
+    // Nonzero while parsing a for-loop body: statement lists must stop at
+    // the contextual 'done' keyword instead of consuming it as a command
+    int for_body_depth_{0};
 
     // Parser methods (all updated to match the new AST)
     [[nodiscard]] std::expected<StatementNode, ParseError> parse_statement();
@@ -76,41 +112,115 @@ private:
     [[nodiscard]] std::expected<CommandNode, ParseError> parse_command();
     [[nodiscard]] std::expected<StatementNode, ParseError> parse_pipeline();
     [[nodiscard]] std::expected<StatementNode, ParseError> parse_list();
+    [[nodiscard]] std::expected<ForNode, ParseError> parse_for_loop();
+    [[nodiscard]] std::expected<FunctionNode, ParseError> parse_function();
+    [[nodiscard]] std::expected<void, ParseError>
+    parse_do_block(std::pmr::vector<StatementNode>& body);
+
+    // Token lookahead ring: every token is lexed exactly once into a slot
+    // and handed out by reference, so check/match/peek never copy and the
+    // fixed window gives the grammar multi-token lookahead. References stay
+    // valid until the token is consumed and its slot refilled.
+    static constexpr std::size_t LOOKAHEAD = 4;
+    std::array<Token, LOOKAHEAD> ring_{
+        Token{TokenType::EndOfFile}, Token{TokenType::EndOfFile},
+        Token{TokenType::EndOfFile}, Token{TokenType::EndOfFile}};
+    std::size_t ring_head_{0};   // slot holding the current token
+    std::size_t ring_count_{0};  // filled slots
+
+    void fill_ring(std::size_t needed);
+    [[nodiscard]] Token fetch_token();
 
     // Token helpers
-    [[nodiscard]] Token peek_token();
-    [[nodiscard]] Token current_token();
+    [[nodiscard]] const Token& peek_token();
+    [[nodiscard]] const Token& peek_ahead(std::size_t n);
+    Token next_token();
+    [[nodiscard]] const Token& current_token();
     bool check(TokenType type);
     void advance();
     [[nodiscard]] bool match(TokenType t);
     void skip_newlines();
+    [[nodiscard]] bool at_for_terminator();
 
     [[nodiscard]] ParseError make_error(ParseErrorKind kind,
                                         const std::string& message);
 };
 
+// ============================================================================
+// Parser Session (incremental REPL continuation)
+// ============================================================================
+
+/// Accumulates a multi-line REPL statement without re-lexing earlier lines.
+///
+/// The naive continuation loop re-runs parse_line over the whole buffer each
+/// time a line is appended, so an N-line construct costs O(N^2) lex work.
+/// A session lexes each fed line exactly once, caches the tokens (with line
+/// numbers offset to the session-relative line), and re-parses only the
+/// cached token stream — parsing is a cursor walk over ~N tokens, with no
+/// character-level work repeated. Call reset() after a completed (or
+/// hard-failed) statement to start the next one.
+class ParserSession {
+public:
+    /// `arena` backs the AST of every parse attempt, same as Parser
+    explicit ParserSession(
+        std::pmr::memory_resource* arena = std::pmr::get_default_resource())
+        : arena_(arena) {}
+
+    /// Append one line (without trailing newline) and try to parse the
+    /// accumulated statement. IncompleteInput means: feed another line.
+    [[nodiscard]] std::expected<std::unique_ptr<ProgramNode>, ParseError>
+    feed(std::string_view line);
+
+    /// Discard all accumulated lines and tokens
+    void reset();
+
+    /// Number of lines fed since the last reset
+    [[nodiscard]] std::size_t line_count() const noexcept { return lines_.size(); }
+
+private:
+    std::deque<std::string> lines_;  // owned line storage; token values view in
+    std::vector<Token> tokens_;      // cached tokens for all fed lines
+    std::pmr::memory_resource* arena_;
+};
+
+// ============================================================================
+// AST Trace Facility (opt-in debugging)
+// ============================================================================
+
+/// Install a sink that receives a pretty-printed AST dump after every
+/// successful parse_line()/parse_program() call. Pass nullptr to disable
+/// (the default). With no sink installed, parsing performs no I/O at all.
+void set_ast_trace_sink(IOutputDestination* sink);
+
+/// Dump a program to the installed trace sink, if any (no-op otherwise).
+void trace_ast(const ProgramNode& program);
+
 // ============================================================================
 // Convenience Functions
 // ============================================================================
 
-/// Parse a line of shell code
+/// Parse a line of shell code (optionally arena-backed, see Parser)
 [[nodiscard]] inline std::expected<std::unique_ptr<ProgramNode>, ParseError>
-parse_line(std::string_view source) {
-    Parser parser(source, true);
+parse_line(std::string_view source,
+           std::pmr::memory_resource* arena = std::pmr::get_default_resource()) {
+    StageTimer timer(Stage::Parse);
+    Parser parser(source, true, arena);
     auto result = parser.parse_line();
     if (result.has_value()) {
-        print_program(*result.value(), std::cout);
+        trace_ast(*result.value());
     }
     return result;
 }
 
-/// Parse a complete program (script)
+/// Parse a complete program (script; optionally arena-backed, see Parser)
 [[nodiscard]] inline std::expected<std::unique_ptr<ProgramNode>, ParseError>
-parse_program(std::string_view source) {
-    Parser parser(source, false);
+parse_program(std::string_view source,
+              std::pmr::memory_resource* arena = std::pmr::get_default_resource()) {
+    StageTimer timer(Stage::Parse);
+    Parser parser(source, false, arena);
     auto result = parser.parse_program();
     if (result.has_value()) {
-        print_program(*result.value(), std::cout);
+        trace_ast(*result.value());
     }
     return result;
 }
@@ -0,0 +1,77 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// plan_cache.hpp - Memoized line -> parsed-program cache for the REPL
+//
+// Orchestrated workloads resubmit the same few hundred distinct command
+// lines continuously; without a cache every occurrence pays full lex, parse
+// and AST construction. The cache maps the raw input line to an immutable,
+// heap-backed ProgramNode, so repeats skip the whole front end. Caching
+// stops at the AST on purpose: variable expansion still runs per execution
+// (and is already skipped for words without '$' via needs_expansion), so a
+// cached plan stays correct when variables change and no cross-component
+// invalidation protocol is needed.
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "ast.hpp"
+#include "parser.hpp"
+
+namespace wshell {
+
+class PlanCache {
+public:
+    static constexpr std::size_t DEFAULT_MAX_ENTRIES = 512;
+
+    explicit PlanCache(std::size_t max_entries = DEFAULT_MAX_ENTRIES)
+        : max_entries_(max_entries == 0 ? DEFAULT_MAX_ENTRIES : max_entries) {}
+
+    /// Look up a previously memoized plan for this exact line.
+    /// Returns nullptr on miss; the pointer stays valid until clear().
+    [[nodiscard]] const ProgramNode* lookup(std::string_view line) const {
+        auto it = plans_.find(line);
+        return it != plans_.end() ? it->second.get() : nullptr;
+    }
+
+    /// Parse `line` with the default (heap) resource and memoize the result
+    /// so later occurrences hit. Lines that fail to parse are not cached;
+    /// re-memoizing an existing line is a no-op.
+    void memoize(const std::string& line) {
+        if (plans_.contains(line)) {
+            return;
+        }
+        // Bound memory for unique-line workloads: steady-state repetitive
+        // traffic repopulates a cleared cache within a few lines
+        if (plans_.size() >= max_entries_) {
+            plans_.clear();
+        }
+        auto parsed = parse_line(line);
+        if (parsed.has_value()) {
+            plans_.emplace(line, std::move(*parsed));
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return plans_.size(); }
+
+    void clear() { plans_.clear(); }
+
+private:
+    // Heterogeneous hashing so lookup takes string_view without a key copy
+    struct StringHash {
+        using is_transparent = void;
+        [[nodiscard]] std::size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::size_t max_entries_;
+    std::unordered_map<std::string, std::unique_ptr<const ProgramNode>, StringHash,
+                       std::equal_to<>>
+        plans_;
+};
+
+} // namespace wshell
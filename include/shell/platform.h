@@ -15,6 +15,16 @@ std::optional<std::string> get_current_directory();
 // Terminate a process by ID
 bool terminate_process(int pid);
 
+// Block until the given process exits; returns its exit code, or nullopt if
+// it cannot be waited for. Reports 128+signal for signal deaths (POSIX).
+std::optional<int> wait_for_process(int pid);
+
+// Resume a stopped process group (SIGCONT on POSIX; no-op elsewhere)
+bool continue_process_group(int pgid);
+
+
+// True when stdin is a terminal (false for pipes/files, i.e. batch mode)
+bool stdin_is_interactive();
 
 // Get home directory as string (platform-specific)
 std::optional<std::string> get_home_directory();
@@ -4,20 +4,32 @@
 // shell_interpreter.hpp - High-level shell interpreter that processes AST
 #pragma once
 
+#include <atomic>
 #include <expected>
 #include <optional>
+#include <thread>
 
-#include <iostream>
-#include <map>
+#include <algorithm>
+#include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "alloc_stats.hpp"
 #include "ast.hpp"
+#include "ast_to_command_model.hpp"
 #include "built_ins.hpp"
+#include "capture_buffer.hpp"
 #include "command_model.hpp"
 #include "execution_policy.hpp"
+#include "glob.hpp"
 #include "history.hpp"
 #include "output_destination.hpp"
+#include "parser.hpp"
+#include "stage_stats.hpp"
+#include "trace.hpp"
+#include "variable_store.hpp"
 
 namespace wshell {
 
@@ -46,10 +58,17 @@ public:
                     output_(output),
                     error_output_(error_output),
                     history_{},
-                    builtins_{&history_} {}
+                    context_{},
+                    builtins_{&history_, &context_} {
+                executor_.init_job_control();
+        }
 
     /// Execute a parsed program (AST)
     [[nodiscard]] int execute_program(const ProgramNode& program) {
+        // Report background jobs that finished since the last line, the way
+        // interactive shells do, before running anything new
+        notify_completed_jobs();
+
         int last_exit_code = platform::EXIT_SUCCESS_STATUS;
 
         for (const auto& statement : program.statements) {
@@ -67,20 +86,20 @@ public:
 
     /// Get a variable value
     [[nodiscard]] std::optional<std::string>
-    get_variable(const std::string& name) const {
-        auto it = variables_.find(name);
-        if (it != variables_.end())
-            return it->second;
+    get_variable(std::string_view name) const {
+        auto value = variables_.get(name);
+        if (value.has_value())
+            return std::string(*value);
         return std::nullopt;
     }
 
     /// Set a variable value
-    void set_variable(const std::string& name, const std::string& value) {
-        variables_[name] = value;
+    void set_variable(std::string_view name, const std::string& value) {
+        variables_.set(name, value);
     }
 
-    /// Get all variables
-    [[nodiscard]] const std::map<std::string, std::string>&
+    /// Get all variables (contiguous entries, insertion order)
+    [[nodiscard]] const VariableStore&
     variables() const noexcept {
         return variables_;
     }
@@ -98,59 +117,188 @@ public:
         history_.push(command);
     };
 
+    /// Command history (for the line editor's navigation and search)
+    [[nodiscard]] const History& history() const noexcept { return history_; }
+
+    /// Background job table (for inspection and the jobs builtin)
+    [[nodiscard]] const std::vector<JobWithState>& jobs() const noexcept {
+        return context_.jobs;
+    }
+
+    /// Poll the job table once and report any jobs that have completed.
+    /// Non-blocking; called before each program so completion is announced
+    /// at the next prompt rather than whenever the child happens to exit.
+    void notify_completed_jobs() {
+        if (context_.jobs.empty()) {
+            return;
+        }
+        // SIGCHLD-gated: when the handler is installed, skip the waitpid
+        // sweep entirely unless a child actually exited since last time
+        if constexpr (requires { Policy::sigchld_pending(); }) {
+            if (!Policy::sigchld_pending()) {
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < context_.jobs.size();) {
+            auto& job = context_.jobs[i];
+            auto result = executor_.try_wait(job.process_group.native_handle());
+            if (!result.has_value()) {
+                ++i;  // still running
+                continue;
+            }
+
+            job.state = result->is_success() ? JobWithState::State::Done
+                                             : JobWithState::State::Terminated;
+            (void)output_.write("[" + std::to_string(job.job_id) + "] " +
+                                (job.state == JobWithState::State::Done ? "Done" : "Exit " +
+                                 std::to_string(result->exit_code)) +
+                                "\t" + job_display_name(job) + "\n");
+            context_.remove_job(job.job_id);
+        }
+    }
+
     
+    /// Expand $VAR / ${VAR} references against the interpreter's variable
+    /// store and run $(command) substitutions through the executor's
+    /// capture machinery. See expand_with for the mechanics.
     std::string expand_variables(std::string_view input) {
+        return expand_with(
+            input, [this](std::string_view name) { return variables_.get(name); },
+            [this](std::string_view inner) { return run_command_substitution(inner); });
+    }
+
+    /// Variable-only expansion (no command substitution): $(...) spans pass
+    /// through verbatim. Kept for callers that must not spawn processes.
+    template <typename Lookup>
+    std::string expand_with(std::string_view input, Lookup&& lookup) {
+        return expand_with(input, std::forward<Lookup>(lookup),
+                           [](std::string_view) { return std::optional<std::string>{}; });
+    }
+
+    /// Single pass over the input view: literal spans between '$' signs are
+    /// appended as bulk ranges and variable names are sliced straight out of
+    /// the view, resolved through `lookup` (heterogeneous, no temporary
+    /// keys). Inputs without a '$' return after one find() and one copy.
+    /// Parameterizing the lookup lets parallel for-loops overlay an
+    /// iteration-local binding without touching the shared store.
+    /// `substitute` receives the inner text of each $(...) span and returns
+    /// its replacement, or nullopt to emit the span unchanged; substitution
+    /// output is spliced in literally, never re-expanded (bash semantics).
+    template <typename Lookup, typename Substitute>
+    std::string expand_with(std::string_view input, Lookup&& lookup,
+                            Substitute&& substitute) {
+        std::size_t next = input.find('$');
+        if (next == std::string_view::npos) {
+            return std::string(input);  // nothing to expand
+        }
+
         std::string result;
-        const std::string str(input);
-        size_t i = 0;
-        while (i < str.size()) {
-            if (str[i] == '$') {
-                size_t var_start = i + 1;
-                size_t var_end = var_start;
-                std::string var_name;
-                if (var_start < str.size() && str[var_start] == '{') {
-                    // ${VAR} syntax
-                    var_start++;
-                    var_end = var_start;
-                    while (var_end < str.size() && str[var_end] != '}') ++var_end;
-                    var_name = str.substr(var_start, var_end - var_start);
-                    i = (var_end < str.size()) ? var_end + 1 : str.size();
-                } else {
-                    // $VAR syntax
-                    while (var_end < str.size() && (std::isalnum(str[var_end]) || str[var_end] == '_')) ++var_end;
-                    var_name = str.substr(var_start, var_end - var_start);
-                    i = var_end;
+        // Most expansions roughly preserve length; over-reserve a little so
+        // typical values don't force a regrow
+        result.reserve(input.size() + 16);
+
+        std::size_t pos = 0;
+        while (next != std::string_view::npos) {
+            result.append(input.substr(pos, next - pos));
+
+            std::size_t var_start = next + 1;
+
+            // $(command) substitution: find the matching close paren
+            // (parens nest), hand the inner text to `substitute`
+            if (var_start < input.size() && input[var_start] == '(') {
+                std::size_t scan = var_start + 1;
+                int depth = 1;
+                while (scan < input.size() && depth > 0) {
+                    if (input[scan] == '(') {
+                        ++depth;
+                    } else if (input[scan] == ')') {
+                        --depth;
+                    }
+                    ++scan;
                 }
-                if (!var_name.empty()) {
-                    auto it = variables_.find(var_name);
-                    if (it != variables_.end()) {
-                        result += it->second;
+                if (depth == 0) {
+                    std::string_view inner =
+                        input.substr(var_start + 1, scan - var_start - 2);
+                    if (auto replacement = substitute(inner)) {
+                        result.append(*replacement);
+                    } else {
+                        result.append(input.substr(next, scan - next));
                     }
+                    pos = scan;
                 } else {
-                    result += '$';
+                    // Unterminated $( — emit literally
+                    result.push_back('$');
+                    pos = var_start;
+                }
+                next = input.find('$', pos);
+                continue;
+            }
+            std::string_view var_name;
+            if (var_start < input.size() && input[var_start] == '{') {
+                // ${VAR} syntax (an unterminated brace consumes the rest)
+                ++var_start;
+                const std::size_t var_end = input.find('}', var_start);
+                if (var_end == std::string_view::npos) {
+                    var_name = input.substr(var_start);
+                    pos = input.size();
+                } else {
+                    var_name = input.substr(var_start, var_end - var_start);
+                    pos = var_end + 1;
+                }
+            } else {
+                // $VAR syntax
+                std::size_t var_end = var_start;
+                while (var_end < input.size() &&
+                       (std::isalnum(static_cast<unsigned char>(input[var_end])) ||
+                        input[var_end] == '_')) {
+                    ++var_end;
+                }
+                var_name = input.substr(var_start, var_end - var_start);
+                pos = var_end;
+            }
+
+            if (!var_name.empty()) {
+                auto value = lookup(var_name);
+                if (value.has_value()) {
+                    result.append(*value);
                 }
             } else {
-                result += str[i];
-                ++i;
+                result.push_back('$');
             }
+
+            next = input.find('$', pos);
         }
+        result.append(input.substr(pos));
+        AllocStats::instance().record(AllocSite::Expansion, result.size());
         return result;
     }
 
 private:
     Executor<Policy> executor_;
-    std::map<std::string, std::string> variables_;
+    VariableStore variables_;
     wshell::IOutputDestination& output_;
     wshell::IOutputDestination& error_output_;
     wshell::History history_;
-    wshell::BuiltIns builtins_;
+    ExecutionContext context_;  // runtime state: job table, exit status
+    wshell::BuiltIns builtins_; // registered after context_ (jobs/fg/bg use it)
     ShellProcessContext process_context_;
 
+    // User-defined functions: name -> heap-owned body (see define_function).
+    // Invocation is entirely in-process — no subshell is spawned.
+    std::unordered_map<std::string, std::vector<StatementNode>> functions_;
+    int function_call_depth_{0};
+    int substitution_depth_{0};
+    // Bumped whenever functions_ changes; routing caches stamped with an
+    // older generation re-resolve (see CommandNode::route_generation).
+    // Starts at 1 so a default-stamped node (0) never matches.
+    std::uint32_t function_generation_{1};
+
 
 
     /// Execute a single statement
     [[nodiscard]] std::expected<int, std::string>
     execute_statement(const StatementNode& statement) {
+        StageTimer timer(Stage::Execute);
         return std::visit(overloaded{
 
             [&](const CommentNode& node) -> std::expected<int, std::string> {
@@ -171,6 +319,14 @@ private:
 
             [&](const SequenceNode& node) -> std::expected<int, std::string> {
                 return execute_sequence(node);
+            },
+
+            [&](const ForNode& node) -> std::expected<int, std::string> {
+                return execute_for(node);
+            },
+
+            [&](const FunctionNode& node) -> std::expected<int, std::string> {
+                return define_function(node);
             }
 
         }, statement);
@@ -193,74 +349,507 @@ private:
     /// Execute a command
     [[nodiscard]] std::expected<int, std::string>
     execute_command(const CommandNode& node) {
-        std::string cmd_name = expand_variables(node.command_name.text);
-        std::vector<std::string> args;
-        args.push_back(cmd_name);
-        for (const auto& arg : node.arguments) {
-            std::string expanded_arg;
-            if (arg.quoted) {
-                expanded_arg = expand_variables(arg.text);
-            } else {
-                expanded_arg = expand_variables(arg.text);
+        // Literal words (the common case) skip the expansion scan entirely;
+        // the parser marks needs_expansion only for words containing '$'
+        auto expand_word = [this](const Word& w) -> std::string {
+            return w.needs_expansion ? expand_variables(w.text) : std::string(w.text);
+        };
+
+        // Routed fast path: a plan-cached node with a literal name keeps
+        // its resolved route across executions, so repeats dispatch with no
+        // string lookups at all (see CommandNode::route)
+        if (node.route != CommandRoute::Unresolved &&
+            node.route_generation == function_generation_) {
+            switch (node.route) {
+                case CommandRoute::Builtin:
+                    return run_builtin(*static_cast<BuiltinFunction*>(node.route_handle),
+                                       node, expand_word);
+                case CommandRoute::Function:
+                    return run_function(
+                        *static_cast<const std::vector<StatementNode>*>(node.route_handle),
+                        node, expand_word);
+                case CommandRoute::External:
+                    return run_external(node, std::string(node.command_name.text),
+                                        expand_word);
+                case CommandRoute::Unresolved:
+                    break;  // unreachable
             }
-            args.push_back(expanded_arg);
         }
 
-        // Check for built-in
-        if (builtins_.is_builtin_command(cmd_name)) {
-            auto* fn = builtins_.get_builtin_function(cmd_name);
-            if (fn) {
-                int code = fn->invoke(args, process_context_);
-                return code;
-            } else {
-                return std::unexpected("Builtin not implemented: " + cmd_name);
+        std::string cmd_name = expand_word(node.command_name);
+        // Expanded names can resolve differently every execution, so only
+        // literal names are worth remembering
+        const bool cacheable = !node.command_name.needs_expansion;
+        auto remember = [&](CommandRoute route, void* handle) {
+            if (cacheable) {
+                node.route = route;
+                node.route_handle = handle;
+                node.route_generation = function_generation_;
             }
+        };
+
+        // Check for built-in: one frozen-table probe covers both the "is it
+        // a builtin" test and the dispatch target
+        if (auto* fn = builtins_.find(cmd_name)) {
+            remember(CommandRoute::Builtin, fn);
+            return run_builtin(*fn, node, expand_word);
+        }
+
+        // User-defined function: the body runs in-process on this
+        // interpreter — no subshell is spawned. Builtins win the name
+        // clash above, so functions can't shadow shell machinery.
+        if (auto fn_it = functions_.find(cmd_name); fn_it != functions_.end()) {
+            remember(CommandRoute::Function, &fn_it->second);
+            return run_function(fn_it->second, node, expand_word);
+        }
+
+        remember(CommandRoute::External, nullptr);
+        return run_external(node, std::move(cmd_name), expand_word);
+    }
+
+    /// Dispatch a command to a builtin
+    template <typename ExpandWord>
+    [[nodiscard]] std::expected<int, std::string>
+    run_builtin(BuiltinFunction& fn, const CommandNode& node, ExpandWord&& expand_word) {
+        std::vector<std::string> args;
+        args.reserve(node.arguments.size() + 1);
+        args.push_back(expand_word(node.command_name));
+        for (const auto& arg : node.arguments) {
+            args.push_back(expand_word(arg));
+        }
+        return fn.invoke(args, process_context_);
+    }
+
+    /// Dispatch a command to a user-defined function body
+    template <typename ExpandWord>
+    [[nodiscard]] std::expected<int, std::string>
+    run_function(const std::vector<StatementNode>& body, const CommandNode& node,
+                 ExpandWord&& expand_word) {
+        std::vector<std::string> args;
+        args.reserve(node.arguments.size());
+        for (const auto& arg : node.arguments) {
+            args.push_back(expand_word(arg));
+        }
+        return invoke_function(body, args);
+    }
+
+    /// Dispatch a command to an external process
+    template <typename ExpandWord>
+    [[nodiscard]] std::expected<int, std::string>
+    run_external(const CommandNode& node, std::string cmd_name, ExpandWord&& expand_word) {
+        Command cmd = build_external_command(node, std::move(cmd_name), expand_word);
+        trace_exec([&] {
+            return "redirections: " + std::to_string(node.redirections.size()) +
+                   " for command: " + cmd.executable.string();
+        });
+
+        // Background command: launch without waiting, record in the job
+        // table, and return to the prompt immediately
+        if (node.background) {
+            return launch_background_job(std::move(cmd));
         }
 
-        // External command execution (as before)
+        auto result = executor_.execute(cmd);
+        trace_exec([&] {
+            std::ostringstream os;
+            os << "executed: " << cmd.executable.string() << " -> " << result;
+            return os.str();
+        });
+
+        return result.exit_code;
+    }
+
+    /// Build the external-command model for a CommandNode, expanding every
+    /// word through `expand_word`. Shared between execute_command and the
+    /// parallel for-loop engine (which supplies an iteration-local expander).
+    template <typename ExpandWord>
+    [[nodiscard]] Command build_external_command(const CommandNode& node, std::string cmd_name,
+                                                 ExpandWord&& expand_word) {
         Command cmd;
-        cmd.executable = cmd_name;
+        cmd.type = CommandType::External;
+        cmd.executable = std::move(cmd_name);
         cmd.args.reserve(node.arguments.size());
+        // One expander (and thus one directory-listing cache) per command
+        // line: 'a/*.c b/*.c a/*.h' reads each directory exactly once
+        GlobExpander globber;
         for (const auto& arg : node.arguments) {
-            std::string expanded_arg;
-            if (arg.quoted) {
-                expanded_arg = expand_variables(arg.text);
-            } else {
-                expanded_arg = expand_variables(arg.text);
+            std::string value = expand_word(arg);
+            if (!arg.quoted && GlobPattern::contains_glob(value)) {
+                auto matches = globber.expand(value);
+                if (!matches.empty()) {
+                    for (auto& match : matches) {
+                        cmd.args.emplace_back(std::move(match), false, false);
+                    }
+                    continue;
+                }
+                // No matches: the literal pattern passes through (bash
+                // semantics without nullglob)
+            }
+            cmd.args.emplace_back(std::move(value), arg.quoted, arg.needs_expansion);
+        }
+
+        for (const auto& redir : node.redirections) {
+            if (redir.kind == RedirectKind::Input) {
+                cmd.stdin_ = from_file(expand_word(redir.target));
+            } else if (redir.kind == RedirectKind::OutputTruncate) {
+                cmd.stdout_ = to_file(expand_word(redir.target), OpenMode::WriteTruncate);
+            } else if (redir.kind == RedirectKind::OutputAppend) {
+                cmd.stdout_ = to_file(expand_word(redir.target), OpenMode::WriteAppend);
             }
-            cmd.args.emplace_back(expanded_arg, arg.quoted, arg.needs_expansion);
-        }
-
-        if (!node.redirections.empty()) {
-            std::cout << "Processing redirections for command: " << cmd.executable << "\n";
-            for (const auto& redir : node.redirections) {
-                if (redir.kind == RedirectKind::Input) {
-                    std::cout << "  Input redirection from: " << redir.target << "\n";
-                    cmd.stdin_ = from_file(expand_variables(redir.target.text));
-                } else if (redir.kind == RedirectKind::OutputTruncate) {
-                    std::cout << "  Output redirection to: " << redir.target << "\n";
-                    cmd.stdout_ = to_file(expand_variables(redir.target.text), OpenMode::WriteTruncate);
-                } else if (redir.kind == RedirectKind::OutputAppend) {
-                    std::cout << "  Output append redirection to: " << redir.target << "\n";
-                    cmd.stdout_ = to_file(expand_variables(redir.target.text), OpenMode::WriteAppend);
+        }
+        std::size_t marshalled = cmd.executable.native().size();
+        for (const auto& arg : cmd.args) {
+            marshalled += arg.value.size();
+        }
+        AllocStats::instance().record(AllocSite::ExecMarshal, marshalled);
+        return cmd;
+    }
+
+    /// Execute a for loop. Values are expanded once up front; like bash,
+    /// the loop variable stays bound to its last value after the loop.
+    [[nodiscard]] std::expected<int, std::string> execute_for(const ForNode& node) {
+        std::vector<std::string> values;
+        values.reserve(node.values.size());
+        for (const auto& value : node.values) {
+            values.push_back(value.needs_expansion ? expand_variables(value.text)
+                                                   : std::string(value.text));
+        }
+        if (values.empty()) {
+            return platform::EXIT_SUCCESS_STATUS;
+        }
+
+        if (node.parallel) {
+            return execute_for_parallel(node, values);
+        }
+
+        int last = platform::EXIT_SUCCESS_STATUS;
+        for (const auto& value : values) {
+            variables_.set(node.variable, value);
+            for (const auto& stmt : node.body) {
+                auto result = execute_statement(stmt);
+                if (!result) {
+                    return result;
+                }
+                last = *result;
+            }
+        }
+        return last;
+    }
+
+    /// A parallel loop body may contain commands, pipelines, comments and
+    /// sequences thereof — anything that only reads interpreter state.
+    /// Assignments (and nested loops, which may contain them) are rejected
+    /// because workers share the variable store.
+    [[nodiscard]] static bool parallel_body_ok(const StatementNode& stmt) {
+        return std::visit(
+            overloaded{[](const CommandNode&) { return true; },
+                       [](const PipelineNode&) { return true; },
+                       [](const CommentNode&) { return true; },
+                       [](const SequenceNode& seq) {
+                           return std::all_of(seq.statements.begin(), seq.statements.end(),
+                                              [](const StatementNode& inner) {
+                                                  return parallel_body_ok(inner);
+                                              });
+                       },
+                       [](const auto&) { return false; }},
+            stmt);
+    }
+
+    /// Parallel loop engine ('par'): a bounded worker set claims iterations
+    /// from a shared atomic counter — lock-free dynamic load balancing,
+    /// which matters because fan-out over file lists has wildly uneven
+    /// per-item cost. Each iteration expands its body with the loop
+    /// variable bound iteration-locally (the shared store is only read
+    /// while workers run) and spawns through the executor. Bodies are
+    /// restricted to commands and pipelines: assignments and builtins
+    /// mutate shared interpreter state and would race. Exit codes are
+    /// aggregated in iteration order, not completion order.
+    [[nodiscard]] std::expected<int, std::string>
+    execute_for_parallel(const ForNode& node, const std::vector<std::string>& values) {
+        for (const auto& stmt : node.body) {
+            if (!parallel_body_ok(stmt)) {
+                return std::unexpected(
+                    "parallel for loop bodies support commands and pipelines only");
+            }
+        }
+
+        std::size_t worker_count =
+            node.max_jobs != 0 ? node.max_jobs
+                               : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        worker_count = std::min(worker_count, values.size());
+
+        std::vector<int> results(values.size(), platform::EXIT_SUCCESS_STATUS);
+        std::atomic<std::size_t> next_index{0};
+
+        auto run_iteration = [&](const std::string& value) -> int {
+            // Iteration-local binding: the loop variable resolves to this
+            // iteration's value; everything else reads the shared store
+            auto expand_word = [&](const Word& w) -> std::string {
+                if (!w.needs_expansion) {
+                    return std::string(w.text);
+                }
+                return expand_with(
+                    w.text, [&](std::string_view name) -> std::optional<std::string_view> {
+                        if (name == node.variable) {
+                            return std::string_view(value);
+                        }
+                        return variables_.get(name);
+                    });
+            };
+            auto run_command = [&](const CommandNode& cmd_node) -> int {
+                Command cmd = build_external_command(
+                    cmd_node, expand_word(cmd_node.command_name), expand_word);
+                return executor_.execute(cmd).exit_code;
+            };
+
+            auto run_statement = [&](auto&& self, const StatementNode& stmt) -> int {
+                if (const auto* cmd_node = std::get_if<CommandNode>(&stmt)) {
+                    return run_command(*cmd_node);
+                }
+                if (const auto* pipe_node = std::get_if<PipelineNode>(&stmt)) {
+                    int last = platform::EXIT_SUCCESS_STATUS;
+                    for (const auto& piped : pipe_node->commands) {
+                        last = run_command(piped);
+                    }
+                    return last;
+                }
+                if (const auto* seq_node = std::get_if<SequenceNode>(&stmt)) {
+                    int last = platform::EXIT_SUCCESS_STATUS;
+                    for (const auto& inner : seq_node->statements) {
+                        last = self(self, inner);
+                    }
+                    return last;
                 }
+                return platform::EXIT_SUCCESS_STATUS;  // comments
+            };
+
+            int last = platform::EXIT_SUCCESS_STATUS;
+            for (const auto& stmt : node.body) {
+                last = run_statement(run_statement, stmt);
+            }
+            return last;
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        for (std::size_t i = 0; i < worker_count; ++i) {
+            workers.emplace_back([&] {
+                while (true) {
+                    const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+                    if (index >= values.size()) {
+                        break;
+                    }
+                    results[index] = run_iteration(values[index]);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // Ordered aggregation: the first failing iteration in value order
+        // decides the loop's exit code
+        for (int code : results) {
+            if (code != platform::EXIT_SUCCESS_STATUS) {
+                return code;
             }
-        } else {
-            std::cout << "No redirections for command: " << cmd.executable << "\n";
+        }
+        return platform::EXIT_SUCCESS_STATUS;
+    }
+
+    /// Register a user-defined function. The parsed body lives in the
+    /// per-line arena, which is reset after execution, so it is deep-copied
+    /// into default-allocated vectors here (pmr allocators don't propagate
+    /// on copy). Word text stays valid across the copy — it views the
+    /// process-lifetime interning pool. Redefinition replaces the old body.
+    [[nodiscard]] std::expected<int, std::string>
+    define_function(const FunctionNode& node) {
+        functions_[node.name] =
+            std::vector<StatementNode>(node.body.begin(), node.body.end());
+        ++function_generation_;
+        return platform::EXIT_SUCCESS_STATUS;
+    }
+
+    /// Invoke a stored function body in-process. Positionals $1..$N are
+    /// bound on the variable store for the duration of the call and
+    /// restored afterwards (to their prior value, or "" when previously
+    /// unset — the store never erases), so calls nest correctly. A depth
+    /// guard keeps runaway recursion from overflowing the C++ stack.
+    [[nodiscard]] std::expected<int, std::string>
+    invoke_function(const std::vector<StatementNode>& body,
+                    const std::vector<std::string>& args) {
+        static constexpr int MAX_FUNCTION_DEPTH = 64;
+        if (function_call_depth_ >= MAX_FUNCTION_DEPTH) {
+            return std::unexpected("function call depth limit exceeded");
         }
 
+        std::vector<std::pair<std::string, std::string>> saved;
+        saved.reserve(args.size());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            std::string name = std::to_string(i + 1);
+            auto prior = variables_.get(name);
+            saved.emplace_back(name, prior ? std::string(*prior) : std::string{});
+            variables_.set(name, args[i]);
+        }
+
+        ++function_call_depth_;
+        std::expected<int, std::string> result = platform::EXIT_SUCCESS_STATUS;
+        for (const auto& stmt : body) {
+            result = execute_statement(stmt);
+            if (!result) {
+                break;
+            }
+        }
+        --function_call_depth_;
+
+        for (auto it = saved.rbegin(); it != saved.rend(); ++it) {
+            variables_.set(it->first, std::move(it->second));
+        }
+        return result;
+    }
+
+    /// Run one $(command) substitution: parse the inner text, execute it
+    /// with stdout captured through the executor's pipe machinery, and
+    /// return the output with trailing newlines stripped (bash semantics).
+    /// No temp files are involved, and capture storage is recycled through
+    /// CaptureBufferPool across substitutions. Errors report to stderr and
+    /// substitute the empty string, like a failing $() in other shells.
+    std::optional<std::string> run_command_substitution(std::string_view inner) {
+        static constexpr int MAX_SUBSTITUTION_DEPTH = 16;
+        if (substitution_depth_ >= MAX_SUBSTITUTION_DEPTH) {
+            (void)error_output_.write("wshell: command substitution: nesting too deep\n");
+            return std::string{};
+        }
+        ++substitution_depth_;
+        std::string output = run_substitution_body(inner);
+        --substitution_depth_;
+
+        // Trailing newlines are an artifact of line-oriented tools, not data
+        while (!output.empty() && output.back() == '\n') {
+            output.pop_back();
+        }
+        return output;
+    }
+
+    std::string run_substitution_body(std::string_view inner) {
+        auto program = parse_line(inner);
+        if (!program) {
+            (void)error_output_.write("wshell: command substitution: " +
+                                      program.error().message_ + "\n");
+            return {};
+        }
+
+        std::string output;
+        auto run_node = [&](auto&& self, const StatementNode& stmt) -> void {
+            if (const auto* cmd_node = std::get_if<CommandNode>(&stmt)) {
+                capture_command_output(*cmd_node, output);
+            } else if (const auto* seq = std::get_if<SequenceNode>(&stmt)) {
+                for (const auto& nested : seq->statements) {
+                    self(self, nested);
+                }
+            } else if (!std::holds_alternative<CommentNode>(stmt)) {
+                (void)error_output_.write(
+                    "wshell: command substitution supports simple commands only\n");
+            }
+        };
+        for (const auto& stmt : (*program)->statements) {
+            run_node(run_node, stmt);
+        }
+        return output;
+    }
+
+    /// Execute one command with stdout captured and append its output.
+    /// Builtins and functions write to the shell's own stdout and cannot be
+    /// captured in-process, so substitution is external-command only.
+    void capture_command_output(const CommandNode& node, std::string& output) {
+        auto expand_word = [this](const Word& w) -> std::string {
+            return w.needs_expansion ? expand_variables(w.text) : std::string(w.text);
+        };
+        std::string cmd_name = expand_word(node.command_name);
+        if (builtins_.find(cmd_name) != nullptr || functions_.contains(cmd_name)) {
+            (void)error_output_.write(
+                "wshell: command substitution: '" + cmd_name +
+                "' is not an external command and cannot be captured\n");
+            return;
+        }
+
+        Command cmd = build_external_command(node, std::move(cmd_name), expand_word);
+        cmd.stdout_ = capture();
         auto result = executor_.execute(cmd);
-        std::cout << "Executed command: " << cmd.executable << "\n";
-        std::cout << result << "\n";
+        if (result.error_message.has_value()) {
+            (void)error_output_.write("wshell: command substitution: " +
+                                      *result.error_message + "\n");
+        }
+        output.append(result.captured_stdout);
+        // Hand the (pooled) capture storage back for the next substitution
+        CaptureBufferPool::instance().release(std::move(result.captured_stdout));
+    }
 
-        return result.exit_code;
+    /// Launch a command asynchronously and register it as a job
+    [[nodiscard]] std::expected<int, std::string>
+    launch_background_job(Command cmd) {
+        auto pid = executor_.execute_async(cmd);
+        if (!pid) {
+            return std::unexpected(pid.error());
+        }
+
+        JobWithState job;
+        job.content = std::move(cmd);
+        job.process_group = platform::ProcessGroup::create(*pid);
+        job.background = true;
+        job.state = JobWithState::State::Running;
+
+        int job_id = context_.add_job(std::move(job));
+        (void)output_.write("[" + std::to_string(job_id) + "] " + std::to_string(*pid) + "\n");
+        return platform::EXIT_SUCCESS_STATUS;
     }
 
-    /// Execute a pipeline (currently sequential, left-to-right)
+    /// Human-readable name for a job (executable of its first command)
+    [[nodiscard]] static std::string job_display_name(const JobWithState& job) {
+        return std::visit(overloaded{
+            [](const Command& cmd) { return cmd.executable.string(); },
+            [](const Pipeline& pipeline) {
+                return pipeline.empty() ? std::string{}
+                                        : pipeline.commands.front().executable.string();
+            }
+        }, job.content);
+    }
+
+    /// Execute a pipeline. All-external pipelines lower to a single
+    /// wshell::Pipeline — expansions resolved, globs applied, redirections
+    /// attached, builtin stages identified, all in one pass — and reach the
+    /// executor in one call, which spawns every stage concurrently with
+    /// kernel pipes between them. Stages that resolve to builtins or
+    /// functions run in-process on this interpreter and cannot be spawned,
+    /// so those pipelines (and backgrounded ones, which the job table
+    /// tracks per command) keep the sequential left-to-right path.
     [[nodiscard]] std::expected<int, std::string>
     execute_pipeline(const PipelineNode& node) {
-        int last = platform::EXIT_SUCCESS_STATUS;
+        if (node.commands.size() > 1) {
+            auto expand_word = [this](const Word& w) -> std::string {
+                return w.needs_expansion ? expand_variables(w.text) : std::string(w.text);
+            };
+            // Identification and lowering share one pass, so each stage
+            // name expands exactly once
+            auto lower_stage = [&](const CommandNode& stage) -> std::optional<Command> {
+                std::string name = expand_word(stage.command_name);
+                if (stage.background || builtins_.find(name) != nullptr ||
+                    functions_.find(name) != functions_.end()) {
+                    return std::nullopt;
+                }
+                return build_external_command(stage, std::move(name), expand_word);
+            };
+            if (auto pipeline = ast_pipeline_to_model(node, lower_stage)) {
+                auto result = executor_.execute(*pipeline);
+                trace_exec([&] {
+                    return "executed pipeline: " + std::to_string(pipeline->size()) +
+                           " stages -> " + std::to_string(result.exit_code);
+                });
+                return result.exit_code;
+            }
+        }
 
+        int last = platform::EXIT_SUCCESS_STATUS;
         for (const auto& cmd : node.commands) {
             auto result = execute_command(cmd);
             if (!result) {
@@ -288,12 +877,12 @@ private:
         return last;
     }
 
-    [[nodiscard]] std::optional<std::string> lookup_variable(const std::string& name) {
-        if (variables_.contains(name)) {
-            return variables_[name];
-        } else {
-            return std::nullopt;
+    [[nodiscard]] std::optional<std::string> lookup_variable(std::string_view name) {
+        auto value = variables_.get(name);
+        if (value.has_value()) {
+            return std::string(*value);
         }
+        return std::nullopt;
     }
 
     [[nodiscard]] std::vector<std::string> getHistory() {
@@ -0,0 +1,158 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// stage_stats.hpp - Lightweight per-stage latency histograms
+//
+// Answers "where does wshell spend its time" without an external profiler:
+// each pipeline stage (lex+parse, statement execution, process spawn+wait)
+// records its wall-clock duration into a fixed-size log2 histogram. Recording
+// is one clock read plus one relaxed atomic increment, so it stays on in
+// production builds. The `stats` builtin turns the histograms into
+// p50/p95/p99 summaries at the prompt.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace wshell {
+
+/// Instrumented pipeline stages. Keep kStageCount in sync.
+enum class Stage : std::size_t {
+    Parse = 0,       // lexing + parsing (parse_line / parse_program)
+    Execute = 1,     // ShellInterpreter::execute_statement (incl. expansion)
+    Spawn = 2,       // PlatformExecutionPolicy::execute (spawn + wait)
+};
+
+inline constexpr std::size_t kStageCount = 3;
+
+/// Display name for a stage (fixed table, no allocation).
+[[nodiscard]] constexpr const char* stage_name(Stage stage) noexcept {
+    switch (stage) {
+        case Stage::Parse:   return "parse";
+        case Stage::Execute: return "execute";
+        case Stage::Spawn:   return "spawn";
+    }
+    return "unknown";
+}
+
+/// Process-wide latency histograms, one per stage.
+///
+/// Buckets are powers of two in nanoseconds: bucket i counts durations in
+/// [2^(i-1), 2^i). 48 buckets cover sub-microsecond up to several hours,
+/// which is more range than any shell stage needs. Percentiles are
+/// reconstructed from bucket counts, so they are accurate to within one
+/// power of two — plenty for "parsing got 10x slower" questions.
+class StageStats {
+public:
+    static constexpr std::size_t kBucketCount = 48;
+
+    /// Process-wide instance (same pattern as EnvironmentCache/StringPool)
+    static StageStats& instance() {
+        static StageStats stats;
+        return stats;
+    }
+
+    /// Record one duration for a stage. Lock-free and wait-free.
+    void record(Stage stage, std::uint64_t duration_ns) noexcept {
+        auto& histogram = histograms_[static_cast<std::size_t>(stage)];
+        histogram[bucket_index(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Point-in-time summary of one stage's histogram
+    struct Summary {
+        std::uint64_t count = 0;
+        std::uint64_t p50_ns = 0;
+        std::uint64_t p95_ns = 0;
+        std::uint64_t p99_ns = 0;
+    };
+
+    /// Compute count and percentile estimates for a stage.
+    [[nodiscard]] Summary summarize(Stage stage) const noexcept {
+        const auto& histogram = histograms_[static_cast<std::size_t>(stage)];
+
+        std::array<std::uint64_t, kBucketCount> counts{};
+        Summary summary;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            counts[i] = histogram[i].load(std::memory_order_relaxed);
+            summary.count += counts[i];
+        }
+        if (summary.count == 0) {
+            return summary;
+        }
+
+        summary.p50_ns = percentile_from(counts, summary.count, 50);
+        summary.p95_ns = percentile_from(counts, summary.count, 95);
+        summary.p99_ns = percentile_from(counts, summary.count, 99);
+        return summary;
+    }
+
+    /// Zero all histograms (e.g. `stats reset`). Not atomic with respect to
+    /// concurrent record() calls; a handful of lost samples is acceptable.
+    void reset() noexcept {
+        for (auto& histogram : histograms_) {
+            for (auto& bucket : histogram) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    StageStats() = default;
+
+    /// log2 bucket for a duration: bucket i holds [2^(i-1), 2^i)
+    [[nodiscard]] static constexpr std::size_t bucket_index(std::uint64_t ns) noexcept {
+        const auto width = static_cast<std::size_t>(std::bit_width(ns));
+        return width < kBucketCount ? width : kBucketCount - 1;
+    }
+
+    /// Upper bound of a bucket's range, used as the percentile estimate
+    [[nodiscard]] static constexpr std::uint64_t bucket_upper_ns(std::size_t index) noexcept {
+        return index == 0 ? 0 : (std::uint64_t{1} << index) - 1;
+    }
+
+    [[nodiscard]] static std::uint64_t
+    percentile_from(const std::array<std::uint64_t, kBucketCount>& counts,
+                    std::uint64_t total, std::uint64_t percentile) noexcept {
+        // Rank of the requested percentile, rounding up (1-based)
+        const std::uint64_t rank = (total * percentile + 99) / 100;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return bucket_upper_ns(i);
+            }
+        }
+        return bucket_upper_ns(kBucketCount - 1);
+    }
+
+    using Histogram = std::array<std::atomic<std::uint64_t>, kBucketCount>;
+    std::array<Histogram, kStageCount> histograms_{};
+};
+
+/// RAII timer: records the enclosing scope's duration into a stage histogram.
+/// One steady_clock read on entry and one on exit; nothing else on the path.
+class StageTimer {
+public:
+    explicit StageTimer(Stage stage) noexcept
+        : stage_(stage), start_(std::chrono::steady_clock::now()) {}
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    ~StageTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        StageStats::instance().record(
+            stage_, static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+private:
+    Stage stage_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace wshell
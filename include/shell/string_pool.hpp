@@ -0,0 +1,126 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// string_pool.hpp - Hash-consed string interning pool
+#pragma once
+
+#include "alloc_stats.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace wshell {
+
+/// Hash-consed string table shared by the parsing pipeline. Interning a
+/// string returns a stable string_view valid for the pool's lifetime, and
+/// interning the same characters again returns the identical view (same
+/// data pointer) with zero allocations. REPL workloads repeat the same
+/// command names and flag words line after line, so the steady-state cost
+/// of a word is one hash probe instead of one heap allocation.
+///
+/// Storage is bump-allocated in fixed chunks; interned strings are never
+/// freed (the table only ever grows, bounded by the set of distinct words
+/// seen). Same layout discipline as VariableStore: a contiguous entry list
+/// plus an open-addressed slot index sized to a power of two.
+class StringPool {
+public:
+    /// Process-wide pool used by the Parser (guarded internally)
+    static StringPool& instance() {
+        static StringPool pool;
+        return pool;
+    }
+
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// Return the canonical stable view for `s`, copying it into the pool
+    /// on first sight
+    [[nodiscard]] std::string_view intern(std::string_view s) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (slots_.empty()) {
+            slots_.assign(INITIAL_SLOT_COUNT, NPOS);
+        }
+
+        const std::size_t hash = std::hash<std::string_view>{}(s);
+        std::size_t slot = hash & (slots_.size() - 1);
+        while (slots_[slot] != NPOS) {
+            const std::string_view candidate = entries_[slots_[slot]];
+            if (candidate == s) {
+                return candidate;  // hash-consed hit: same data pointer as before
+            }
+            slot = (slot + 1) & (slots_.size() - 1);
+        }
+
+        const std::string_view stored = store(s);
+        // Only first-sight copies count; hash-consed hits allocate nothing
+        AllocStats::instance().record(AllocSite::Lexer, s.size());
+        slots_[slot] = static_cast<std::uint32_t>(entries_.size());
+        entries_.push_back(stored);
+
+        if (entries_.size() * 10 >= slots_.size() * 7) {
+            grow();
+        }
+        return stored;
+    }
+
+    /// Number of distinct strings interned so far
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    static constexpr std::size_t INITIAL_SLOT_COUNT = 256;  // power of two
+    static constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+    static constexpr std::uint32_t NPOS = UINT32_MAX;
+
+    // Copy into bump storage; oversized strings get a dedicated chunk
+    [[nodiscard]] std::string_view store(std::string_view s) {
+        if (s.size() > CHUNK_SIZE) {
+            auto chunk = std::make_unique<char[]>(s.size());
+            std::memcpy(chunk.get(), s.data(), s.size());
+            const char* data = chunk.get();
+            // Keep the current bump chunk in place at the back
+            chunks_.insert(chunks_.empty() ? chunks_.end() : chunks_.end() - 1,
+                           std::move(chunk));
+            return {data, s.size()};
+        }
+
+        if (chunks_.empty() || chunk_used_ + s.size() > CHUNK_SIZE) {
+            chunks_.push_back(std::make_unique<char[]>(CHUNK_SIZE));
+            chunk_used_ = 0;
+        }
+        char* dest = chunks_.back().get() + chunk_used_;
+        std::memcpy(dest, s.data(), s.size());
+        chunk_used_ += s.size();
+        return {dest, s.size()};
+    }
+
+    void grow() {
+        std::vector<std::uint32_t> new_slots(slots_.size() * 2, NPOS);
+        for (std::uint32_t i = 0; i < entries_.size(); ++i) {
+            std::size_t slot =
+                std::hash<std::string_view>{}(entries_[i]) & (new_slots.size() - 1);
+            while (new_slots[slot] != NPOS) {
+                slot = (slot + 1) & (new_slots.size() - 1);
+            }
+            new_slots[slot] = i;
+        }
+        slots_ = std::move(new_slots);
+    }
+
+    std::vector<std::unique_ptr<char[]>> chunks_;  // bump chunk at the back
+    std::size_t chunk_used_{0};
+    std::vector<std::string_view> entries_;    // interned strings, stable
+    std::vector<std::uint32_t> slots_;         // open-addressed index
+    mutable std::mutex mutex_;
+};
+
+}  // namespace wshell
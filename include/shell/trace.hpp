@@ -0,0 +1,42 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// trace.hpp - Compile-time-gated execution tracing
+#pragma once
+
+#include <string_view>
+#include <utility>
+
+// Compiled out entirely unless the build defines WSHELL_TRACE_EXEC=1
+// (cmake -DENABLE_EXEC_TRACE=ON). With it off, trace calls and the code
+// that formats their messages vanish at compile time, so the command
+// execution hot path performs no stream I/O at all.
+#ifndef WSHELL_TRACE_EXEC
+    #define WSHELL_TRACE_EXEC 0
+#endif
+
+namespace wshell {
+
+class IOutputDestination;
+
+inline constexpr bool kExecTraceCompiledIn = (WSHELL_TRACE_EXEC != 0);
+
+/// Install the destination that receives execution trace lines (nullptr
+/// disables). Only meaningful in builds with WSHELL_TRACE_EXEC=1; same
+/// opt-in sink pattern as set_ast_trace_sink.
+void set_exec_trace_sink(IOutputDestination* sink);
+
+/// Write one trace line to the installed sink, if any (appends '\n')
+void exec_trace_write(std::string_view message);
+
+/// Trace an execution event. `build` is a callable returning the message
+/// (std::string or string_view); it is never invoked — or even compiled
+/// into the binary — when tracing is disabled.
+template <typename BuildFn>
+inline void trace_exec([[maybe_unused]] BuildFn&& build) {
+    if constexpr (kExecTraceCompiledIn) {
+        exec_trace_write(std::forward<BuildFn>(build)());
+    }
+}
+
+}  // namespace wshell
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+// variable_store.hpp - Flat, open-addressing shell variable store
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wshell {
+
+// ============================================================================
+// VariableStore - flat-hash storage for shell variables
+// ============================================================================
+
+/// Shell variable store built for the expansion hot path:
+///  - open-addressing (linear probing) index instead of a node-based tree,
+///  - heterogeneous string_view lookup, so `$VAR` expansion never allocates
+///    a temporary key,
+///  - names interned once in a contiguous entry array, so iteration (the
+///    `variables()` accessor, env export) is cache-friendly.
+/// Variables are never erased individually (the shell has no unset yet), so
+/// entry indices are stable for the lifetime of the store.
+class VariableStore {
+public:
+    struct Entry {
+        std::string name;
+        std::string value;
+    };
+
+    VariableStore() : slots_(INITIAL_SLOT_COUNT, NPOS) {}
+
+    /// Look up a variable; the returned view stays valid until the entry is
+    /// overwritten or the store is cleared
+    [[nodiscard]] std::optional<std::string_view> get(std::string_view name) const noexcept {
+        const std::size_t slot = find_slot(name);
+        if (slots_[slot] == NPOS) {
+            return std::nullopt;
+        }
+        return std::string_view{entries_[slots_[slot]].value};
+    }
+
+    [[nodiscard]] bool contains(std::string_view name) const noexcept {
+        return slots_[find_slot(name)] != NPOS;
+    }
+
+    /// Set (or overwrite) a variable
+    void set(std::string_view name, std::string value) {
+        std::size_t slot = find_slot(name);
+        if (slots_[slot] != NPOS) {
+            entries_[slots_[slot]].value = std::move(value);
+            return;
+        }
+        // Keep the table under ~70% load
+        if ((entries_.size() + 1) * 10 >= slots_.size() * 7) {
+            grow();
+            slot = find_slot(name);
+        }
+        slots_[slot] = static_cast<std::uint32_t>(entries_.size());
+        entries_.push_back(Entry{std::string(name), std::move(value)});
+    }
+
+    void clear() {
+        entries_.clear();
+        slots_.assign(INITIAL_SLOT_COUNT, NPOS);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    /// Contiguous entries in insertion order (cache-friendly iteration)
+    [[nodiscard]] const std::vector<Entry>& entries() const noexcept { return entries_; }
+
+    [[nodiscard]] auto begin() const noexcept { return entries_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return entries_.end(); }
+
+private:
+    static constexpr std::size_t INITIAL_SLOT_COUNT = 64;  // power of two
+    static constexpr std::uint32_t NPOS = UINT32_MAX;
+
+    // Linear-probe to the slot holding `name`, or the empty slot where it
+    // would be inserted
+    [[nodiscard]] std::size_t find_slot(std::string_view name) const noexcept {
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t i = std::hash<std::string_view>{}(name) & mask;
+        while (slots_[i] != NPOS && entries_[slots_[i]].name != name) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void grow() {
+        slots_.assign(slots_.size() * 2, NPOS);
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t idx = 0; idx < entries_.size(); ++idx) {
+            std::size_t i = std::hash<std::string_view>{}(entries_[idx].name) & mask;
+            while (slots_[i] != NPOS) {
+                i = (i + 1) & mask;
+            }
+            slots_[i] = static_cast<std::uint32_t>(idx);
+        }
+    }
+
+    std::vector<Entry> entries_;          // interned names + values, contiguous
+    std::vector<std::uint32_t> slots_;    // open-addressing index into entries_
+};
+
+}  // namespace wshell
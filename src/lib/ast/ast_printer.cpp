@@ -71,6 +71,29 @@ void print_sequence(const SequenceNode& seq, std::ostream& os, int indent_level)
         print_node(stmt, os, indent_level + 1);
 }
 
+void print_for(const ForNode& loop, std::ostream& os, int indent_level) {
+    indent(os, indent_level);
+    os << "For: " << loop.variable << " in";
+    for (const auto& value : loop.values)
+        os << " " << value;
+    if (loop.parallel) {
+        os << " (parallel";
+        if (loop.max_jobs != 0)
+            os << ", jobs=" << loop.max_jobs;
+        os << ")";
+    }
+    os << "\n";
+    for (const auto& stmt : loop.body)
+        print_node(stmt, os, indent_level + 1);
+}
+
+void print_function(const FunctionNode& fn, std::ostream& os, int indent_level) {
+    indent(os, indent_level);
+    os << "Function: " << fn.name << "\n";
+    for (const auto& stmt : fn.body)
+        print_node(stmt, os, indent_level + 1);
+}
+
 // -----------------------------------------------------------------------------
 // Core variant printer
 // -----------------------------------------------------------------------------
@@ -97,6 +120,12 @@ void print_node(const StatementNode& stmt, std::ostream& os, int indent_level) {
             } else if constexpr (std::is_same_v<T, SequenceNode>) {
                 print_sequence(node, os, indent_level);
 
+            } else if constexpr (std::is_same_v<T, ForNode>) {
+                print_for(node, os, indent_level);
+
+            } else if constexpr (std::is_same_v<T, FunctionNode>) {
+                print_function(node, os, indent_level);
+
             } else {
                 indent(os, indent_level);
                 os << "<Unknown node>\n";
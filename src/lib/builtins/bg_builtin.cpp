@@ -0,0 +1,51 @@
+#include <cstdlib>
+#include <iostream>
+#include "shell/built_ins.hpp"
+#include "shell/command_model.hpp"
+#include "shell/platform.h"
+
+namespace wshell {
+
+int BgBuiltin::invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) {
+    (void)ctx;
+    if (!exec_ctx_) {
+        std::cerr << "bg: job control not available" << std::endl;
+        return 1;
+    }
+
+    JobWithState* job = nullptr;
+    if (args.size() < 2) {
+        // Default: most recently stopped job
+        for (auto it = exec_ctx_->jobs.rbegin(); it != exec_ctx_->jobs.rend(); ++it) {
+            if (it->state == JobWithState::State::Stopped) {
+                job = &(*it);
+                break;
+            }
+        }
+    } else {
+        const std::string& spec = args[1];
+        const char* digits = (!spec.empty() && spec[0] == '%') ? spec.c_str() + 1 : spec.c_str();
+        job = exec_ctx_->find_job(std::atoi(digits));
+    }
+
+    if (!job) {
+        std::cerr << "bg: no such job" << std::endl;
+        return 1;
+    }
+    if (job->state != JobWithState::State::Stopped) {
+        std::cerr << "bg: job [" << job->job_id << "] is not stopped" << std::endl;
+        return 1;
+    }
+
+    int pgid = static_cast<int>(job->process_group.native_handle());
+    if (!continue_process_group(pgid)) {
+        std::cerr << "bg: failed to resume job [" << job->job_id << "]" << std::endl;
+        return 1;
+    }
+    job->state = JobWithState::State::Running;
+    job->background = true;
+    std::cout << "[" << job->job_id << "] continued" << std::endl;
+    return 0;
+}
+
+}  // namespace wshell
@@ -0,0 +1,54 @@
+#include <cstdlib>
+#include <iostream>
+#include "shell/built_ins.hpp"
+#include "shell/command_model.hpp"
+#include "shell/platform.h"
+
+namespace wshell {
+
+namespace {
+
+// Accepts "3" or "%3"; returns the most recent job when no argument is given
+JobWithState* select_job(ExecutionContext& exec_ctx, const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        return exec_ctx.jobs.empty() ? nullptr : &exec_ctx.jobs.back();
+    }
+    const std::string& spec = args[1];
+    const char* digits = (!spec.empty() && spec[0] == '%') ? spec.c_str() + 1 : spec.c_str();
+    return exec_ctx.find_job(std::atoi(digits));
+}
+
+}  // namespace
+
+int FgBuiltin::invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) {
+    (void)ctx;
+    if (!exec_ctx_) {
+        std::cerr << "fg: job control not available" << std::endl;
+        return 1;
+    }
+
+    JobWithState* job = select_job(*exec_ctx_, args);
+    if (!job) {
+        std::cerr << "fg: no such job" << std::endl;
+        return 1;
+    }
+
+    int pid = static_cast<int>(job->process_group.native_handle());
+    int job_id = job->job_id;
+
+    // Resume the whole group if it was stopped, then wait for the leader
+    if (job->state == JobWithState::State::Stopped) {
+        (void)continue_process_group(pid);
+        job->state = JobWithState::State::Running;
+    }
+
+    auto exit_code = wait_for_process(pid);
+    exec_ctx_->remove_job(job_id);
+    if (!exit_code.has_value()) {
+        std::cerr << "fg: failed to wait for job [" << job_id << "]" << std::endl;
+        return 1;
+    }
+    return *exit_code;
+}
+
+}  // namespace wshell
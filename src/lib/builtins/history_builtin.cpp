@@ -7,12 +7,31 @@
 
 namespace wshell {
 
-HistoryBuiltin::HistoryBuiltin() {}
-
 int HistoryBuiltin::invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) {
-        (void)args;
-        (void)ctx;
-    return 1; //placeholder
+    (void)ctx;
+    if (history_ == nullptr) {
+        std::cerr << "history: no history available\n";
+        return 1;
+    }
+
+    // history search <pattern>: indexed substring query, most recent first
+    if (args.size() >= 2 && args[1] == "search") {
+        if (args.size() != 3) {
+            std::cerr << "usage: history search <pattern>\n";
+            return 1;
+        }
+        auto matches = history_->search(args[2]);
+        for (const auto& line : matches) {
+            std::cout << line << '\n';
+        }
+        return matches.empty() ? 1 : 0;
+    }
+
+    // Plain 'history': dump all entries, oldest first, 1-based numbering
+    for (std::size_t i = 0; i < history_->size(); ++i) {
+        std::cout << "  " << (i + 1) << "  " << history_->item_at(i) << '\n';
+    }
+    return 0;
 }
 
 } // namespace wshell
@@ -0,0 +1,49 @@
+#include <iostream>
+#include "shell/built_ins.hpp"
+#include "shell/command_model.hpp"
+
+namespace wshell {
+
+namespace {
+
+const char* state_name(JobWithState::State state) {
+    switch (state) {
+        case JobWithState::State::Running:    return "Running";
+        case JobWithState::State::Stopped:    return "Stopped";
+        case JobWithState::State::Done:       return "Done";
+        case JobWithState::State::Terminated: return "Terminated";
+    }
+    return "Unknown";
+}
+
+std::string job_command_name(const JobWithState& job) {
+    return std::visit(
+        [](const auto& content) -> std::string {
+            using T = std::decay_t<decltype(content)>;
+            if constexpr (std::is_same_v<T, Command>) {
+                return content.executable.string();
+            } else {
+                return content.empty() ? std::string{}
+                                       : content.commands.front().executable.string();
+            }
+        },
+        job.content);
+}
+
+}  // namespace
+
+int JobsBuiltin::invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) {
+    (void)args;
+    (void)ctx;
+    if (!exec_ctx_) {
+        std::cerr << "jobs: job control not available" << std::endl;
+        return 1;
+    }
+    for (const auto& job : exec_ctx_->jobs) {
+        std::cout << "[" << job.job_id << "] " << state_name(job.state) << "\t"
+                  << job_command_name(job) << (job.background ? " &" : "") << "\n";
+    }
+    return 0;
+}
+
+}  // namespace wshell
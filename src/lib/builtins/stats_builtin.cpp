@@ -0,0 +1,73 @@
+#include <iomanip>
+#include <iostream>
+
+#include "shell/alloc_stats.hpp"
+#include "shell/built_ins.hpp"
+#include "shell/stage_stats.hpp"
+
+namespace wshell {
+
+namespace {
+
+// Durations print in microseconds: big enough to be readable for parse
+// times, small enough to show spawn latency without scientific notation
+double to_us(std::uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+}  // namespace
+
+int StatsBuiltin::invoke(const std::vector<std::string>& args, ShellProcessContext& ctx) {
+    (void)ctx;
+
+    if (args.size() > 1 && args[1] == "reset") {
+        StageStats::instance().reset();
+        AllocStats::instance().reset();
+        std::cout << "stats: histograms and allocation counters reset" << std::endl;
+        return 0;
+    }
+    if (args.size() > 1) {
+        std::cerr << "stats: unknown argument '" << args[1] << "' (usage: stats [reset])"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(10) << "stage" << std::right << std::setw(10) << "count"
+              << std::setw(14) << "p50 (us)" << std::setw(14) << "p95 (us)" << std::setw(14)
+              << "p99 (us)" << "\n";
+
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        const auto stage = static_cast<Stage>(i);
+        const auto summary = StageStats::instance().summarize(stage);
+
+        std::cout << std::left << std::setw(10) << stage_name(stage) << std::right << std::setw(10)
+                  << summary.count;
+        if (summary.count == 0) {
+            std::cout << std::setw(14) << "-" << std::setw(14) << "-" << std::setw(14) << "-"
+                      << "\n";
+            continue;
+        }
+        std::cout << std::fixed << std::setprecision(1) << std::setw(14) << to_us(summary.p50_ns)
+                  << std::setw(14) << to_us(summary.p95_ns) << std::setw(14)
+                  << to_us(summary.p99_ns) << "\n";
+    }
+
+    if constexpr (kAllocStatsCompiledIn) {
+        std::cout << "\n"
+                  << std::left << std::setw(10) << "site" << std::right << std::setw(12)
+                  << "allocs" << std::setw(14) << "bytes" << "\n";
+        for (std::size_t i = 0; i < kAllocSiteCount; ++i) {
+            const auto site = static_cast<AllocSite>(i);
+            const auto snap = AllocStats::instance().snapshot(site);
+            std::cout << std::left << std::setw(10) << alloc_site_name(site) << std::right
+                      << std::setw(12) << snap.count << std::setw(14) << snap.bytes << "\n";
+        }
+        const auto total = AllocStats::instance().total();
+        std::cout << std::left << std::setw(10) << "total" << std::right << std::setw(12)
+                  << total.count << std::setw(14) << total.bytes << "\n";
+    }
+    std::cout << std::flush;
+    return 0;
+}
+
+}  // namespace wshell
@@ -5,8 +5,12 @@
 
 #if defined(__linux__) || defined(__APPLE__)
 
+    #include "shell/capture_buffer.hpp"
     #include "shell/execution_policy.hpp"
+    #include "shell/stage_stats.hpp"
 
+    #include <array>
+    #include <atomic>
     #include <cstring>
     #include <filesystem>
     #include <ios>
@@ -17,11 +21,24 @@
     #include <unordered_map>
     #include <vector>
 
+    #include <csignal>
+
     #include <fcntl.h>
+    #include <poll.h>
     #include <pwd.h>
+    #include <spawn.h>
     #include <sys/wait.h>
     #include <unistd.h>
 
+// posix_spawn_file_actions_addchdir_np is available on glibc >= 2.29 and
+// recent macOS; without it, commands that set work_dir fall back to fork/exec.
+    #if (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))) || \
+        defined(__APPLE__)
+        #define WSHELL_HAVE_SPAWN_ADDCHDIR 1
+    #else
+        #define WSHELL_HAVE_SPAWN_ADDCHDIR 0
+    #endif
+
 extern char** environ;
 
 namespace wshell {
@@ -69,78 +86,261 @@ std::string findExecutableInPath(const std::string& executable_name) {
     return "";
 }
 
-class EnvironmentCache {
+// Cache of command-name -> resolved executable path, so tight loops spawning
+// the same few binaries do not re-walk $PATH (and its stat calls) per launch.
+// Lookups happen in the parent before fork; the child just execs the result.
+// The whole cache is invalidated when $PATH changes, and an individual entry
+// is re-resolved when the mtime of the directory it resolved into changes.
+class ExecutablePathCache {
   public:
-    static EnvironmentCache& instance() {
-        static EnvironmentCache instance;
+    static ExecutablePathCache& instance() {
+        static ExecutablePathCache instance;
         return instance;
     }
 
-    std::string get(const std::string& key) {
+    // Resolve a command name to a full executable path ("" if not found).
+    // Names containing a path separator bypass the cache and are returned
+    // unchanged (resolution of explicit paths is the kernel's job).
+    std::string resolve(const std::string& name) {
+        if (name.find('/') != std::string::npos) {
+            return name;
+        }
+
         std::lock_guard<std::mutex> lock(mutex_);
+        invalidate_if_path_changed();
 
-        auto it = cache_.find(key);
+        auto it = cache_.find(name);
         if (it != cache_.end()) {
-            return it->second;
+            std::error_code ec;
+            auto dir_mtime = fs::last_write_time(it->second.directory, ec);
+            if (!ec && dir_mtime == it->second.directory_mtime) {
+                return it->second.path;
+            }
+            // Directory changed (or vanished) - drop the stale entry
+            cache_.erase(it);
         }
 
-        // Fallback to getenv for new keys
-        if (const char* val = std::getenv(key.c_str())) {
-            cache_[key] = val;
-            return val;
+        std::string found = findExecutableInPath(name);
+        if (!found.empty()) {
+            insert_entry(name, found);
         }
-
-        return "";
+        return found;
     }
 
-    void refresh() {
+    // One-time bulk scan of every $PATH directory, so interactive startup can
+    // pre-warm the cache instead of paying a cold walk on first use.
+    void prescan() {
         std::lock_guard<std::mutex> lock(mutex_);
-        cache_.clear();
-        load_environment();
-    }
+        invalidate_if_path_changed();
 
-    std::unordered_map<std::string, std::string> get_all() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return cache_;
+        const char* path_env = std::getenv("PATH");
+        if (!path_env) {
+            return;
+        }
+
+        std::string path_str = path_env;
+        std::string current_path;
+        std::vector<std::string> directories;
+        for (char c : path_str) {
+            if (c == ':') {
+                directories.push_back(current_path);
+                current_path.clear();
+            } else {
+                current_path += c;
+            }
+        }
+        directories.push_back(current_path);
+
+        for (const std::string& dir : directories) {
+            std::error_code ec;
+            for (const auto& entry : fs::directory_iterator(dir, ec)) {
+                if (!entry.is_regular_file(ec)) {
+                    continue;
+                }
+                if (access(entry.path().c_str(), X_OK) != 0) {
+                    continue;
+                }
+                std::string name = entry.path().filename().string();
+                // First PATH entry wins, matching lookup order
+                if (cache_.find(name) == cache_.end()) {
+                    insert_entry(name, entry.path().string());
+                }
+            }
+        }
     }
 
   private:
-    EnvironmentCache() { load_environment(); }
+    struct Entry {
+        std::string path;                       // full path to the executable
+        std::string directory;                  // directory it resolved into
+        fs::file_time_type directory_mtime{};   // mtime of that directory
+    };
+
+    ExecutablePathCache() = default;
+
+    void invalidate_if_path_changed() {
+        const char* path_env = std::getenv("PATH");
+        std::string current = path_env ? path_env : "";
+        if (current != cached_path_env_) {
+            cache_.clear();
+            cached_path_env_ = std::move(current);
+        }
+    }
+
+    void insert_entry(const std::string& name, const std::string& full_path) {
+        Entry entry;
+        entry.path = full_path;
+        entry.directory = fs::path(full_path).parent_path().string();
+        std::error_code ec;
+        entry.directory_mtime = fs::last_write_time(entry.directory, ec);
+        cache_[name] = std::move(entry);
+    }
+
+    std::unordered_map<std::string, Entry> cache_;
+    std::string cached_path_env_;
+    std::mutex mutex_;
+};
+
+// Cache of the process environment built around immutable snapshots: the
+// current state lives in a shared_ptr<const Snapshot> that writers replace
+// wholesale (copy-on-write) and readers pin with a refcount bump. No reader
+// ever copies the map, and a pinned snapshot — including the flat envp block
+// the spawn paths pass to execve/posix_spawn — stays valid for as long as
+// the caller holds it, regardless of concurrent mutation.
+class EnvironmentCache {
+  public:
+    // Heterogeneous hashing so lookups take string_view without a key copy
+    // (same shape as PlanCache::StringHash)
+    struct StringHash {
+        using is_transparent = void;
+        [[nodiscard]] std::size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
 
-    void load_environment() {
-        std::unordered_map<std::string, std::string> env_map;
+    struct Snapshot {
+        std::unordered_map<std::string, std::string, StringHash, std::equal_to<>> vars;
+        std::vector<std::string> flat_storage;  // key=value strings
+        std::vector<char*> flat_envp;           // pointers into flat_storage, NULL-terminated
+
+        // Allocation-free lookup against this (immutable) snapshot; the
+        // pointer is valid for as long as the snapshot is held
+        [[nodiscard]] const std::string* find(std::string_view key) const {
+            auto it = vars.find(key);
+            return it != vars.end() ? &it->second : nullptr;
+        }
+    };
+
+    static EnvironmentCache& instance() {
+        static EnvironmentCache instance;
+        return instance;
+    }
+
+    // Pin the current snapshot: a refcount bump, no map copy, no blocking
+    // on writers. This replaces the old get_all() map copy.
+    [[nodiscard]] std::shared_ptr<const Snapshot> snapshot() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    // Single-variable lookup ("" if unset): an atomic snapshot load plus a
+    // read-only hash probe. Never takes a lock, never blocks on writers —
+    // concurrent spawns across threads scale without serializing here. For
+    // a copy-free variant, hold a snapshot() and use Snapshot::find.
+    [[nodiscard]] std::string get(std::string_view key) const {
+        auto snap = snapshot();
+        const std::string* value = snap->find(key);
+        return value != nullptr ? *value : std::string{};
+    }
+
+    // Writers are copy-on-write: clone the current map, apply the change,
+    // republish. Deliberately O(environment size) — mutation is rare, reads
+    // are per-spawn.
+    void set(std::string_view key, std::string_view value) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto next = std::make_shared<Snapshot>();
+        next->vars = current_.load(std::memory_order_acquire)->vars;
+        next->vars.insert_or_assign(std::string(key), std::string(value));
+        publish(std::move(next));
+    }
+
+    void unset(std::string_view key) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto next = std::make_shared<Snapshot>();
+        next->vars = current_.load(std::memory_order_acquire)->vars;
+        if (auto it = next->vars.find(key); it != next->vars.end()) {
+            next->vars.erase(it);
+        }
+        publish(std::move(next));
+    }
+
+    // Rebuild from the live process environment and publish atomically
+    void refresh() {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto next = std::make_shared<Snapshot>();
         for (char** env = environ; *env != nullptr; ++env) {
             const char* entry = *env;
             const char* eq = std::strchr(entry, '=');
             if (eq) {
-                std::string key(entry, eq - entry);
-                std::string value(eq + 1);
-                env_map.emplace(std::move(key), std::move(value));
+                next->vars.emplace(std::string(entry, eq - entry), std::string(eq + 1));
             }
         }
+        publish(std::move(next));
     }
 
-    std::unordered_map<std::string, std::string> cache_;
-    std::mutex mutex_;
-};
+    // Cheap overlay path for per-command env entries: copies only the
+    // pointer array from `snap`, replacing or appending entries from
+    // `overlay`. The overlay's key=value strings live in `overlay_storage`,
+    // which the caller must keep alive (with `snap`) for the spawn.
+    static std::vector<char*> flat_envp_with_overlay(const Snapshot& snap, const EnvMap& overlay,
+                                                     std::vector<std::string>& overlay_storage) {
+        std::vector<char*> envp = snap.flat_envp;
+        envp.pop_back();  // drop the NULL terminator while editing
+
+        // Reserve up front so .data() pointers stay stable while we push
+        overlay_storage.reserve(overlay_storage.size() + overlay.size());
+        for (const auto& [key, value] : overlay) {
+            overlay_storage.push_back(key + "=" + value);
+            char* entry = overlay_storage.back().data();
+            bool replaced = false;
+            for (auto& existing : envp) {
+                if (std::strncmp(existing, key.c_str(), key.size()) == 0 &&
+                    existing[key.size()] == '=') {
+                    existing = entry;
+                    replaced = true;
+                    break;
+                }
+            }
+            if (!replaced) {
+                envp.push_back(entry);
+            }
+        }
 
-std::vector<const char*> PlatformExecutionPolicy::convertEnvironment(const Command& cmd) {
-    // Set up environment variables
-    std::unordered_map<std::string, std::string> env_map;
-    env_map.insert(cmd.env.begin(), cmd.env.end());
-    if (cmd.env_inherit) {
-        // Add current environment to env
-        auto current_env = EnvironmentCache::instance().get_all();
-        env_map.insert(current_env.begin(), current_env.end());
+        envp.push_back(nullptr);
+        return envp;
     }
-    std::vector<const char*> envp;
-    for (const auto& arg : env_map) {
-        envp.push_back((arg.first + "=" + arg.second).c_str());
+
+  private:
+    EnvironmentCache() { refresh(); }
+
+    // Finish building `next` (flat envp block) and make it current. Must be
+    // called with write_mutex_ held; readers holding the old snapshot keep
+    // it alive through their shared_ptr.
+    void publish(std::shared_ptr<Snapshot> next) {
+        next->flat_storage.reserve(next->vars.size());
+        for (const auto& [key, value] : next->vars) {
+            next->flat_storage.push_back(key + "=" + value);
+        }
+        next->flat_envp.reserve(next->flat_storage.size() + 1);
+        for (auto& s : next->flat_storage) {
+            next->flat_envp.push_back(s.data());
+        }
+        next->flat_envp.push_back(nullptr);
+        current_.store(std::move(next), std::memory_order_release);
     }
-    envp.push_back(nullptr);  // NULL-terminated
 
-    return envp;
-}
+    std::atomic<std::shared_ptr<const Snapshot>> current_;
+    std::mutex write_mutex_;  // serializes writers only; readers never take it
+};
 
 std::vector<const char*> PlatformExecutionPolicy::convertArgv(const Command& cmd) {
     // Convert command args to C-style argv
@@ -155,120 +355,507 @@ std::vector<const char*> PlatformExecutionPolicy::convertArgv(const Command& cmd
     return argv;
 }
 
+void PlatformExecutionPolicy::prescan_path() {
+    ExecutablePathCache::instance().prescan();
+}
+
+namespace {
+
+// Can this command be launched via the posix_spawn fast path?
+// Falls back to fork/exec only when a feature genuinely requires it.
+bool can_posix_spawn(const Command& cmd) {
+    if (cmd.work_dir.has_value() && !WSHELL_HAVE_SPAWN_ADDCHDIR) {
+        return false;
+    }
+    // File actions cover inherit/file/null endpoints; pipe and capture
+    // endpoints need descriptor plumbing the fork path owns.
+    auto simple_io = [](const IO& io) {
+        return std::holds_alternative<InheritTarget>(io) ||
+               std::holds_alternative<FileTarget>(io) || std::holds_alternative<NullTarget>(io);
+    };
+    return simple_io(cmd.stdin_) && simple_io(cmd.stdout_) && simple_io(cmd.stderr_);
+}
+
+// Create a pipe with both ends close-on-exec (pipe2 where available)
+int make_cloexec_pipe(int fds[2]) {
+    #if defined(__linux__)
+    return pipe2(fds, O_CLOEXEC);
+    #else
+    if (pipe(fds) < 0) {
+        return -1;
+    }
+    (void)fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    (void)fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return 0;
+    #endif
+}
+
+// envp block for a spawn. `env_snapshot` receives a pin on the current
+// environment snapshot; it and `overlay_envp`/`overlay_storage` back the
+// returned pointers and must outlive the spawn. The common case (inherit,
+// no per-command entries) is just the snapshot's prebuilt flat block.
+char* const* spawn_envp(const Command& cmd,
+                        std::shared_ptr<const EnvironmentCache::Snapshot>& env_snapshot,
+                        std::vector<char*>& overlay_envp,
+                        std::vector<std::string>& overlay_storage) {
+    env_snapshot = EnvironmentCache::instance().snapshot();
+    if (cmd.env_inherit && cmd.env.empty()) {
+        return env_snapshot->flat_envp.data();
+    }
+
+    if (!cmd.env_inherit) {
+        // Use exactly cmd.env
+        overlay_storage.reserve(cmd.env.size());
+        overlay_envp.reserve(cmd.env.size() + 1);
+        for (const auto& [key, value] : cmd.env) {
+            overlay_storage.push_back(key + "=" + value);
+            overlay_envp.push_back(overlay_storage.back().data());
+        }
+        overlay_envp.push_back(nullptr);
+    } else {
+        overlay_envp =
+            EnvironmentCache::flat_envp_with_overlay(*env_snapshot, cmd.env, overlay_storage);
+    }
+    return overlay_envp.data();
+}
+
+// Shared /dev/null descriptor for NullTarget endpoints, opened once per
+// shell process instead of once per redirected command — batch jobs that
+// discard output on nearly every spawn save an open(2)/close(2) pair each
+// time. O_RDWR serves both directions; O_CLOEXEC keeps it out of children
+// (dup2 clears the flag on the target descriptor, so redirections survive).
+int dev_null_fd() {
+    static int fd = open("/dev/null", O_RDWR | O_CLOEXEC);  // intentionally process-lifetime
+    return fd;
+}
+
+// Drain up to two capture pipes into their buffers, then close them.
+// splice(2) only moves bytes between descriptors, so for pipe -> memory the
+// minimal-copy option is large read(2) calls straight into the buffer's
+// tail; 64 KiB matches the default pipe capacity, so a full pipe empties in
+// one syscall. Both streams are polled together to avoid deadlocking when a
+// child fills whichever pipe we are not currently reading.
+void drain_capture_pipes(int out_fd, std::string& out_buf, int err_fd, std::string& err_buf) {
+    constexpr std::size_t CHUNK = 64 * 1024;
+
+    // Append one chunk; false once the pipe is exhausted (EOF or hard error)
+    auto read_some = [](int fd, std::string& buf) -> bool {
+        const std::size_t old_size = buf.size();
+        buf.resize(old_size + CHUNK);
+        ssize_t n = read(fd, buf.data() + old_size, CHUNK);
+        buf.resize(old_size + (n > 0 ? static_cast<std::size_t>(n) : 0));
+        if (n < 0 && errno == EINTR) {
+            return true;
+        }
+        return n > 0;
+    };
+
+    while (out_fd >= 0 || err_fd >= 0) {
+        if (err_fd < 0) {  // only stdout left: plain read loop
+            if (!read_some(out_fd, out_buf)) {
+                close(out_fd);
+                out_fd = -1;
+            }
+            continue;
+        }
+        if (out_fd < 0) {  // only stderr left
+            if (!read_some(err_fd, err_buf)) {
+                close(err_fd);
+                err_fd = -1;
+            }
+            continue;
+        }
+        struct pollfd fds[2] = {{out_fd, POLLIN, 0}, {err_fd, POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(out_fd);
+            close(err_fd);
+            return;
+        }
+        if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR)) != 0 &&
+            !read_some(out_fd, out_buf)) {
+            close(out_fd);
+            out_fd = -1;
+        }
+        if ((fds[1].revents & (POLLIN | POLLHUP | POLLERR)) != 0 &&
+            !read_some(err_fd, err_buf)) {
+            close(err_fd);
+            err_fd = -1;
+        }
+    }
+}
+
+// Error report usable between fork/vfork and execve: async-signal-safe,
+// no allocation, no stdio. With vfork the child shares the parent's address
+// space, so touching iostreams or the heap there would corrupt the parent.
+void child_report_error(const char* msg) {
+    (void)!write(STDERR_FILENO, msg, std::strlen(msg));
+}
+
+// Apply one stdio endpoint in the child between fork/vfork and execve:
+// FileTarget opens with O_CLOEXEC cleared only on the dup2'd target, so the
+// scratch descriptor disappears at exec; NullTarget duplicates the shared
+// /dev/null fd resolved in the parent. Raw syscalls only. Returns false
+// after reporting the failure; the caller _exits.
+bool apply_child_io(const IO& io, int target_fd, int null_fd) {
+    if (std::holds_alternative<NullTarget>(io)) {
+        if (null_fd < 0 || dup2(null_fd, target_fd) < 0) {
+            child_report_error("wshell: failed to redirect to /dev/null\n");
+            return false;
+        }
+        return true;
+    }
+    if (!std::holds_alternative<FileTarget>(io)) {
+        return true;  // inherit needs nothing; pipe/capture are wired elsewhere
+    }
+    const auto& file_target = std::get<FileTarget>(io);
+    int oflag;
+    switch (file_target.mode) {
+        case OpenMode::Read:
+            oflag = O_RDONLY;
+            break;
+        case OpenMode::WriteAppend:
+            oflag = O_WRONLY | O_CREAT | O_APPEND;
+            break;
+        case OpenMode::WriteTruncate:
+        default:
+            oflag = O_WRONLY | O_CREAT | O_TRUNC;
+            break;
+    }
+    // TODO umask
+    int fd = open(file_target.path.c_str(), oflag | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        child_report_error("wshell: failed to open redirection file\n");
+        return false;
+    }
+    if (fd != target_fd && dup2(fd, target_fd) < 0) {
+        child_report_error("wshell: failed to redirect stream\n");
+        return false;
+    }
+    return true;
+}
+
+// Translate one stdio endpoint into a posix_spawn file action. Returns 0 on
+// success or an errno value.
+int add_io_action(posix_spawn_file_actions_t* actions, const IO& io, int target_fd) {
+    if (std::holds_alternative<NullTarget>(io)) {
+        // Prefer duplicating the shared descriptor over a per-command open
+        if (int null_fd = dev_null_fd(); null_fd >= 0) {
+            return posix_spawn_file_actions_adddup2(actions, null_fd, target_fd);
+        }
+        int oflag = (target_fd == STDIN_FILENO) ? O_RDONLY : O_WRONLY;
+        return posix_spawn_file_actions_addopen(actions, target_fd, "/dev/null", oflag, 0);
+    }
+    if (std::holds_alternative<FileTarget>(io)) {
+        const auto& file_target = std::get<FileTarget>(io);
+        int oflag;
+        switch (file_target.mode) {
+            case OpenMode::Read:
+                oflag = O_RDONLY;
+                break;
+            case OpenMode::WriteAppend:
+                oflag = O_WRONLY | O_CREAT | O_APPEND;
+                break;
+            case OpenMode::WriteTruncate:
+            default:
+                oflag = O_WRONLY | O_CREAT | O_TRUNC;
+                break;
+        }
+        return posix_spawn_file_actions_addopen(actions, target_fd, file_target.path.c_str(),
+                                                oflag, 0644);
+    }
+    return 0;  // InheritTarget: nothing to do
+}
+
+// Spawn via posix_spawn without waiting: no page-table copy of the (large)
+// shell process, and redirection setup happens through file actions instead
+// of child-side code. On success `pid` holds the child; on failure an
+// ExecutionResult describing the error is returned. `pgroup` >= 0 places the
+// child in that process group (0 = lead a fresh group); -1 inherits ours.
+std::optional<ExecutionResult> spawn_via_posix_spawn(const Command& cmd,
+                                                     const std::string& resolved_path,
+                                                     pid_t& pid, pid_t pgroup = -1) {
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+
+    int rc = add_io_action(&actions, cmd.stdin_, STDIN_FILENO);
+    if (rc == 0) {
+        rc = add_io_action(&actions, cmd.stdout_, STDOUT_FILENO);
+    }
+    if (rc == 0) {
+        rc = add_io_action(&actions, cmd.stderr_, STDERR_FILENO);
+    }
+    #if WSHELL_HAVE_SPAWN_ADDCHDIR
+    if (rc == 0 && cmd.work_dir.has_value()) {
+        rc = posix_spawn_file_actions_addchdir_np(&actions, cmd.work_dir->c_str());
+    }
+    #endif
+    if (rc != 0) {
+        posix_spawn_file_actions_destroy(&actions);
+        return ExecutionResult{.error_code = rc,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to set up spawn file actions: " +
+                                                std::string(std::strerror(rc))};
+    }
+
+    // argv: same layout as the fork/exec path
+    std::vector<const char*> argv;
+    argv.push_back(cmd.executable.c_str());
+    for (const auto& arg : cmd.args) {
+        argv.push_back(arg.value.c_str());
+    }
+    argv.push_back(nullptr);
+
+    // Environment: the cached flat block, with a cheap overlay when the
+    // command carries its own entries
+    std::shared_ptr<const EnvironmentCache::Snapshot> env_snapshot;
+    std::vector<char*> overlay_envp;
+    std::vector<std::string> overlay_storage;
+    char* const* envp = spawn_envp(cmd, env_snapshot, overlay_envp, overlay_storage);
+
+    // Optional process group placement (job control): done by the spawn
+    // machinery itself, no child-side setpgid race
+    posix_spawnattr_t attr;
+    posix_spawnattr_t* attr_ptr = nullptr;
+    if (pgroup >= 0) {
+        posix_spawnattr_init(&attr);
+        posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+        posix_spawnattr_setpgroup(&attr, pgroup);
+        attr_ptr = &attr;
+    }
+
+    pid = platform::INVALID_PROCESS_ID;
+    rc = posix_spawn(&pid, resolved_path.c_str(), &actions, attr_ptr,
+                     const_cast<char* const*>(argv.data()), envp);
+    posix_spawn_file_actions_destroy(&actions);
+    if (attr_ptr != nullptr) {
+        posix_spawnattr_destroy(attr_ptr);
+    }
+
+    if (rc != 0) {
+        return ExecutionResult{.error_code = rc,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to spawn process: " +
+                                                std::string(std::strerror(rc))};
+    }
+    return std::nullopt;
+}
+
+// Decode a waitpid status into the exit-code convention used throughout
+int decode_wait_status(int status) {
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    if (WIFSIGNALED(status)) {
+        return platform::EXIT_SIGNAL_BASE + WTERMSIG(status);
+    }
+    return platform::EXIT_FAILURE_STATUS;
+}
+
+// Synchronous spawn: launch via posix_spawn, then block until the child exits
+ExecutionResult execute_via_posix_spawn(const Command& cmd, const std::string& resolved_path) {
+    pid_t pid = platform::INVALID_PROCESS_ID;
+    if (auto error = spawn_via_posix_spawn(cmd, resolved_path, pid)) {
+        return *error;
+    }
+
+    int status;
+    if (waitpid(pid, &status, 0) < 0) {
+        return ExecutionResult{.error_code = errno,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to wait for child process"};
+    }
+
+    return ExecutionResult{.exit_code = decode_wait_status(status), .error_message = std::nullopt};
+}
+
+}  // namespace
+
+std::expected<platform::ProcessId, std::string>
+PlatformExecutionPolicy::execute_async(const Command& cmd) const {
+    const std::string resolved_path = ExecutablePathCache::instance().resolve(cmd.executable);
+
+    // Background launches only go through the spawn fast path: the fork
+    // fallback exists for descriptor plumbing that a detached job cannot
+    // use anyway (pipes and captures need a waiting parent).
+    if (!can_posix_spawn(cmd)) {
+        return std::unexpected("Cannot run in background: unsupported I/O redirection");
+    }
+
+    // Each background job leads its own process group so job-control
+    // signals (SIGCONT, SIGTERM) address the whole job at once
+    pid_t pid = platform::INVALID_PROCESS_ID;
+    if (auto error = spawn_via_posix_spawn(cmd, resolved_path, pid, /*pgroup=*/0)) {
+        return std::unexpected(error->error_message.value_or("Failed to spawn process"));
+    }
+    return pid;
+}
+
+std::optional<ExecutionResult> PlatformExecutionPolicy::try_wait(platform::ProcessId pid) {
+    int status = 0;
+    pid_t rc = waitpid(pid, &status, WNOHANG);
+    if (rc == 0) {
+        return std::nullopt;  // still running
+    }
+    if (rc < 0) {
+        return ExecutionResult{.error_code = errno,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to wait for child process: " +
+                                                std::string(std::strerror(errno))};
+    }
+    return ExecutionResult{.exit_code = decode_wait_status(status), .error_message = std::nullopt};
+}
+
 ExecutionResult PlatformExecutionPolicy::execute(const Command& cmd) const {
-    // Fork process
+    // Spawn+wait latency feeds the `stats` builtin's "spawn" histogram
+    StageTimer timer(Stage::Spawn);
+
+    // Resolve the executable in the parent so the PATH walk is cached across
+    // spawns instead of repeating inside every forked child.
+    const std::string resolved_path = ExecutablePathCache::instance().resolve(cmd.executable);
+
+    // Default path: posix_spawn avoids copying the shell's page tables on
+    // every launch. Fork/exec remains only for features spawn can't express.
+    if (can_posix_spawn(cmd)) {
+        return execute_via_posix_spawn(cmd, resolved_path);
+    }
+
+    // NullTarget endpoints share the process-wide /dev/null descriptor,
+    // resolved here so the (possibly vfork'd) child never runs the lazy
+    // static initializer
+    auto is_null = [](const IO& io) { return std::holds_alternative<NullTarget>(io); };
+    int null_fd = -1;
+    if (is_null(cmd.stdin_) || is_null(cmd.stdout_) || is_null(cmd.stderr_)) {
+        null_fd = dev_null_fd();
+        if (null_fd < 0) {
+            return ExecutionResult{.error_code = errno,
+                                   .exit_code = platform::EXIT_FAILURE_STATUS,
+                                   .error_message = "Failed to open /dev/null: " +
+                                                    std::string(std::strerror(errno))};
+        }
+    }
+
+    // CaptureTarget endpoints: one pipe per captured stream, drained by the
+    // parent after the spawn into pooled buffers. Captures need a waiting
+    // parent, so this is inherently a fork-path feature.
+    const bool capture_out = std::holds_alternative<CaptureTarget>(cmd.stdout_);
+    const bool capture_err = std::holds_alternative<CaptureTarget>(cmd.stderr_);
+    int out_pipe[2] = {-1, -1};
+    int err_pipe[2] = {-1, -1};
+    if (capture_out && make_cloexec_pipe(out_pipe) < 0) {
+        return ExecutionResult{.error_code = errno,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to create capture pipe: " +
+                                                std::string(std::strerror(errno))};
+    }
+    if (capture_err && make_cloexec_pipe(err_pipe) < 0) {
+        int saved_errno = errno;
+        if (capture_out) {
+            close(out_pipe[0]);
+            close(out_pipe[1]);
+        }
+        return ExecutionResult{.error_code = saved_errno,
+                               .exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = "Failed to create capture pipe: " +
+                                                std::string(std::strerror(saved_errno))};
+    }
+
+    // Build envp and argv in the parent from the cached flat block; the
+    // child region below performs no allocation (required for the vfork
+    // fast-spawn path, cheaper for plain fork too)
+    std::shared_ptr<const EnvironmentCache::Snapshot> env_snapshot;
+    std::vector<char*> overlay_envp;
+    std::vector<std::string> overlay_storage;
+    char* const* child_envp = spawn_envp(cmd, env_snapshot, overlay_envp, overlay_storage);
+
+    std::vector<const char*> argv;
+    argv.reserve(cmd.args.size() + 2);
+    argv.push_back(cmd.executable.c_str());
+    for (const auto& arg : cmd.args) {
+        argv.push_back(arg.value.c_str());
+    }
+    argv.push_back(nullptr);  // NULL-terminated
+
+#if defined(WSHELL_FAST_SPAWN) && defined(__linux__)
+    // Opt-in fast spawn: vfork() shares the address space and suspends the
+    // parent until exec, skipping the page-table copy that makes fork()
+    // expensive when the shell carries large caches. The child region is
+    // restricted to exec-safe raw syscalls (open/dup2/chdir/execve/_exit
+    // plus write for error reports) — the same set glibc's own
+    // CLONE_VFORK-based posix_spawn performs.
+    pid_t pid = vfork();
+#else
     pid_t pid = fork();
+#endif
 
     if (pid < 0) {
-        // Fork failed
-        return ExecutionResult{.error_code = errno,
+        int saved_errno = errno;
+        for (int fd : {out_pipe[0], out_pipe[1], err_pipe[0], err_pipe[1]}) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+        return ExecutionResult{.error_code = saved_errno,
                                .exit_code = platform::EXIT_FAILURE_STATUS,
-                               .error_message =
-                                   "Failed to fork process: " + std::string(std::strerror(errno))};
+                               .error_message = "Failed to fork process: " +
+                                                std::string(std::strerror(saved_errno))};
     } else if (pid == 0) {
         //
-        // Child process
+        // Child process: raw syscalls only from here to execve. No iostreams,
+        // no stdio, no allocation — child_report_error writes a static
+        // message with write(2).
         //
-        // change into correct directory if needed
         if (cmd.work_dir.has_value()) {
             if (chdir(cmd.work_dir->c_str()) != 0) {
-                perror("chdir");
-                std::cerr << "Failed to change directory: " << std::strerror(errno) << "\n";
-                _exit(127);  // Exit child process
-            }
-        }
-
-        // handle redirections here (TODO)
-        if (std::holds_alternative<FileTarget>(cmd.stdin_)) {
-            // const auto& file_target = std::get<FileTarget>(cmd.stdin_);
-            //  Open file and redirect stdin (TODO)
-        }
-        if (std::holds_alternative<FileTarget>(cmd.stdout_)) {
-            const auto& file_target = std::get<FileTarget>(cmd.stdout_);
-            std::cout << "Redirecting stdout to file: " << file_target.path.c_str() << std::endl;
-            // TODO umask
-            //  Open file and redirect stdout
-            int fd = open(file_target.path.c_str(),
-                          file_target.mode == OpenMode::WriteAppend ? O_WRONLY | O_CREAT | O_APPEND
-                                                                    : O_WRONLY | O_CREAT | O_TRUNC,
-                          0644);
-            if (fd < 0) {
-                perror("Open target file for stdout redirection");
-                std::cerr << "Failed to open file for stdout redirection: " << std::strerror(errno)
-                          << "\n";
-                _exit(126);
-            }
-            if (dup2(fd, STDOUT_FILENO) < 0) {
-                perror("dup2 stdout");
-                std::cerr << "Failed to redirect stdout: " << std::strerror(errno) << "\n";
+                child_report_error("wshell: failed to change directory\n");
                 _exit(127);
             }
-            close(fd);
         }
-        if (std::holds_alternative<FileTarget>(cmd.stderr_)) {
-            // const auto& file_target = std::get<FileTarget>(cmd.stderr_);
-            //  Open file and redirect stderr (TODO)
-        }
-        // Set up environment variables
-        std::unordered_map<std::string, std::string> env_map;
-        if (cmd.env_inherit == false) {
-            // Set provided environment variables
-            env_map.insert(cmd.env.begin(), cmd.env.end());
-        } else {
-            // Modify inherited environment
-            auto current_env = EnvironmentCache::instance().get_all();
-            env_map.insert(current_env.begin(), current_env.end());
-            env_map.insert(cmd.env.begin(), cmd.env.end());
+
+        // Apply stdio redirections for all three streams (FileTarget in any
+        // OpenMode, NullTarget via the shared descriptor)
+        if (!apply_child_io(cmd.stdin_, STDIN_FILENO, null_fd) ||
+            !apply_child_io(cmd.stdout_, STDOUT_FILENO, null_fd) ||
+            !apply_child_io(cmd.stderr_, STDERR_FILENO, null_fd)) {
+            _exit(126);
         }
-        // Convert command args to C-style argv
-        std::vector<const char*> argv;
-        argv.push_back(cmd.executable.c_str());
-        for (const auto& arg : cmd.args) {
-            argv.push_back(arg.value.c_str());
+        // Capture pipes: the O_CLOEXEC originals close themselves at execve
+        if (out_pipe[1] >= 0 && dup2(out_pipe[1], STDOUT_FILENO) < 0) {
+            child_report_error("wshell: failed to redirect stdout to capture pipe\n");
+            _exit(127);
         }
-        argv.push_back(nullptr);  // NULL-terminated
-
-        // Convert environment map to C-style envp
-        std::vector<std::string> env_storage;
-        std::vector<char*> envp;
-        for (const auto& [key, value] : env_map) {
-            env_storage.push_back(key + "=" + value);
-        }
-        for (auto& s : env_storage) {
-            envp.push_back(s.data());
-        }
-        envp.push_back(nullptr);  // Null-terminate
-                                  // Child process - execute command
-        std::string command_path = cmd.executable;
-        /*
-        std::cout << "Executing command: " << command_path << "\n";
-        std::cout << "With arguments:\n";
-        for (size_t i = 0; i < argv.size() - 1; ++i) {
-            std::cout << "  argv[" << i << "] = " << argv[i] << "\n";
-        }
-        std::cout << "With environment variables:\n";
-        for (const auto& [key, value] : env_map) {
-            std::cout << "  " << key << "=" << value << "\n";
-        }
-        std::cout << std::endl;
-        */
-        // lookup executable in PATH if not an absolute or relative path
-        std::string found_path = findExecutableInPath(cmd.executable);
-        auto rc = execve(found_path.c_str(), const_cast<char* const*>(argv.data()),
-                         static_cast<char* const*>(envp.data()));
-        if (rc < 0) {
-            perror("execve");
-            // If execvp returns, it failed
-            std::cerr << "Failed to execute command: " << std::strerror(errno) << "\n";
-            _exit(125);  // Command not fou
-        } else {
-            _exit(0);  // Should never reach here
+        if (err_pipe[1] >= 0 && dup2(err_pipe[1], STDERR_FILENO) < 0) {
+            child_report_error("wshell: failed to redirect stderr to capture pipe\n");
+            _exit(127);
         }
+
+        // Executable, argv and environment were all prepared (and cached)
+        // in the parent
+        (void)execve(resolved_path.c_str(), const_cast<char* const*>(argv.data()),
+                     const_cast<char* const*>(child_envp));
+        child_report_error("wshell: failed to execute command\n");
+        _exit(125);  // Command not found / exec failed
     } else if (pid > 0) {
         //
         // Parent process
         //
-        // Parent process - wait for child
+        // Close the child's write ends so the capture pipes report EOF when
+        // the child exits, then drain fully BEFORE waiting — waiting first
+        // would deadlock once the child fills a pipe nobody is reading.
+        if (out_pipe[1] >= 0) {
+            close(out_pipe[1]);
+        }
+        if (err_pipe[1] >= 0) {
+            close(err_pipe[1]);
+        }
+        std::string out_buf = capture_out ? CaptureBufferPool::instance().acquire() : std::string{};
+        std::string err_buf = capture_err ? CaptureBufferPool::instance().acquire() : std::string{};
+        if (capture_out || capture_err) {
+            drain_capture_pipes(out_pipe[0], out_buf, err_pipe[0], err_buf);
+        }
+
         int status;
         if (waitpid(pid, &status, 0) < 0) {
             perror("waitpid");
@@ -284,26 +871,203 @@ ExecutionResult PlatformExecutionPolicy::execute(const Command& cmd) const {
         } else if (WIFSIGNALED(status)) {
             exit_code = platform::EXIT_SIGNAL_BASE + WTERMSIG(status);
         }
-        return ExecutionResult{.exit_code = exit_code, .error_message = std::nullopt};
+        return ExecutionResult{.exit_code = exit_code,
+                               .error_message = std::nullopt,
+                               .captured_stdout = std::move(out_buf),
+                               .captured_stderr = std::move(err_buf)};
     }
     return ExecutionResult{.error_code = 0, .error_message = std::nullopt};
 }
 ExecutionResult PlatformExecutionPolicy::execute(const Pipeline& pipeline) const {
-    // Phase 1: No pipeline support yet - just execute first command
     if (pipeline.empty()) {
         return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
                                .error_message = "Empty pipeline"};
     }
 
-    // For now, just execute the first command
-    // Phase 2 will add proper pipeline support with pipes
-    return execute(pipeline.commands[0]);
+    // Single-stage "pipelines" take the plain command path
+    if (pipeline.size() == 1) {
+        return execute(pipeline.commands[0]);
+    }
+
+    const std::size_t stage_count = pipeline.size();
+
+    // Wire stage i's stdout to stage i+1's stdin with O_CLOEXEC pipes; the
+    // dup2 file actions below clear the flag only on the descriptors each
+    // stage actually needs, so nothing leaks into the children.
+    std::vector<std::array<int, 2>> pipes(stage_count - 1);
+    for (auto& p : pipes) {
+        if (make_cloexec_pipe(p.data()) < 0) {
+            int saved_errno = errno;
+            for (auto& q : pipes) {
+                if (&q == &p) {
+                    break;
+                }
+                close(q[0]);
+                close(q[1]);
+            }
+            return ExecutionResult{.error_code = saved_errno,
+                                   .exit_code = platform::EXIT_FAILURE_STATUS,
+                                   .error_message = "Failed to create pipe: " +
+                                                    std::string(std::strerror(saved_errno))};
+        }
+    }
+
+    auto close_all_pipes = [&pipes]() {
+        for (auto& p : pipes) {
+            if (p[0] >= 0) close(p[0]);
+            if (p[1] >= 0) close(p[1]);
+        }
+    };
+
+    // Spawn every stage up front so they run concurrently, all in one
+    // process group (led by the first stage).
+    std::vector<pid_t> pids;
+    pids.reserve(stage_count);
+    pid_t pgid = 0;
+    std::optional<std::string> spawn_error;
+
+    for (std::size_t i = 0; i < stage_count; ++i) {
+        const Command& cmd = pipeline.commands[i];
+        const std::string resolved_path = ExecutablePathCache::instance().resolve(cmd.executable);
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+
+        int rc = 0;
+        if (i > 0) {
+            rc = posix_spawn_file_actions_adddup2(&actions, pipes[i - 1][0], STDIN_FILENO);
+        } else {
+            rc = add_io_action(&actions, cmd.stdin_, STDIN_FILENO);
+        }
+        if (rc == 0) {
+            if (i + 1 < stage_count) {
+                rc = posix_spawn_file_actions_adddup2(&actions, pipes[i][1], STDOUT_FILENO);
+            } else {
+                rc = add_io_action(&actions, cmd.stdout_, STDOUT_FILENO);
+            }
+        }
+        if (rc == 0) {
+            rc = add_io_action(&actions, cmd.stderr_, STDERR_FILENO);
+        }
+    #if WSHELL_HAVE_SPAWN_ADDCHDIR
+        if (rc == 0 && cmd.work_dir.has_value()) {
+            rc = posix_spawn_file_actions_addchdir_np(&actions, cmd.work_dir->c_str());
+        }
+    #endif
+
+        // Put the whole pipeline in one process group: the first stage leads,
+        // later stages join it (applied in the child before exec).
+        posix_spawnattr_t attr;
+        posix_spawnattr_init(&attr);
+        if (rc == 0) {
+            rc = posix_spawnattr_setpgroup(&attr, pgid);
+        }
+        if (rc == 0) {
+            rc = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+        }
+
+        std::vector<const char*> argv;
+        argv.push_back(cmd.executable.c_str());
+        for (const auto& arg : cmd.args) {
+            argv.push_back(arg.value.c_str());
+        }
+        argv.push_back(nullptr);
+
+        std::shared_ptr<const EnvironmentCache::Snapshot> env_snapshot;
+        std::vector<char*> overlay_envp;
+        std::vector<std::string> overlay_storage;
+        char* const* envp = spawn_envp(cmd, env_snapshot, overlay_envp, overlay_storage);
+
+        pid_t pid = platform::INVALID_PROCESS_ID;
+        if (rc == 0) {
+            rc = posix_spawn(&pid, resolved_path.c_str(), &actions, &attr,
+                             const_cast<char* const*>(argv.data()), envp);
+        }
+        posix_spawn_file_actions_destroy(&actions);
+        posix_spawnattr_destroy(&attr);
+
+        if (rc != 0) {
+            spawn_error = "Failed to spawn pipeline stage '" + cmd.executable.string() +
+                          "': " + std::string(std::strerror(rc));
+            break;
+        }
+
+        // Also set the group from the parent to close the startup race
+        if (i == 0) {
+            pgid = pid;
+        }
+        (void)setpgid(pid, pgid);
+
+        pids.push_back(pid);
+    }
+
+    // Parent no longer needs any pipe end once all stages are spawned;
+    // closing them delivers EOF/SIGPIPE to the stages correctly.
+    close_all_pipes();
+
+    // Reap every spawned stage; the pipeline's exit code is the last stage's
+    int exit_code = platform::EXIT_FAILURE_STATUS;
+    for (std::size_t i = 0; i < pids.size(); ++i) {
+        int status;
+        if (waitpid(pids[i], &status, 0) < 0) {
+            continue;
+        }
+        if (i + 1 == stage_count) {
+            if (WIFEXITED(status)) {
+                exit_code = WEXITSTATUS(status);
+            } else if (WIFSIGNALED(status)) {
+                exit_code = platform::EXIT_SIGNAL_BASE + WTERMSIG(status);
+            }
+        }
+    }
+
+    if (spawn_error.has_value()) {
+        return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = spawn_error};
+    }
+    return ExecutionResult{.exit_code = exit_code, .error_message = std::nullopt};
+}
+
+namespace {
+
+// SIGCHLD bookkeeping: the handler only raises a flag; actual reaping
+// happens on the main thread via try_wait so the job table stays race-free.
+volatile std::sig_atomic_t g_sigchld_pending = 0;
+bool g_sigchld_handler_installed = false;
+
+void sigchld_handler(int /*signum*/) {
+    g_sigchld_pending = 1;
 }
 
+}  // namespace
+
 void PlatformExecutionPolicy::init_job_control() const {
-    // TODO: Initialize job control for interactive shell
-    // - Set process group
-    // - Configure terminal signals
+    // The shell leads its own process group; background jobs get their own
+    // via POSIX_SPAWN_SETPGROUP at spawn time.
+    (void)setpgid(0, 0);
+
+    struct sigaction sa = {};
+    sa.sa_handler = sigchld_handler;
+    sigemptyset(&sa.sa_mask);
+    // SA_RESTART keeps foreground waitpid/read from failing with EINTR;
+    // SA_NOCLDSTOP because stop notifications are polled, not signalled
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    if (sigaction(SIGCHLD, &sa, nullptr) == 0) {
+        g_sigchld_handler_installed = true;
+    }
+}
+
+bool PlatformExecutionPolicy::sigchld_pending() {
+    // Without the handler there is no edge to observe: report "maybe" so
+    // callers fall back to polling
+    if (!g_sigchld_handler_installed) {
+        return true;
+    }
+    if (g_sigchld_pending) {
+        g_sigchld_pending = 0;
+        return true;
+    }
+    return false;
 }
 
 }  // namespace wshell
@@ -2,110 +2,714 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 // Platform-specific executor implementation for Windows
+//
+// Feature parity with the POSIX executor: a cached CreateProcess
+// environment block (copy-on-write snapshots, same discipline as the POSIX
+// EnvironmentCache), real pipeline wiring over anonymous pipes with every
+// stage spawned up front so they run concurrently, capture-pipe draining
+// for $(command) substitution, and Job Objects backing background jobs so
+// execute_async/try_wait behave identically across platforms.
 
 #if defined(_WIN32)
 
 
     #define _CRT_SECURE_NO_WARNINGS
+    #include "shell/capture_buffer.hpp"
     #include "shell/execution_policy.hpp"
+    #include "shell/stage_stats.hpp"
+
+    #include <algorithm>
+    #include <array>
+    #include <cstring>
+    #include <memory>
+    #include <mutex>
+    #include <optional>
+    #include <string>
+    #include <thread>
+    #include <unordered_map>
+    #include <vector>
 
-    #include <sstream>
     #include <windows.h>
-    #include <iostream>
 
 namespace wshell {
 
+namespace {
+
+// Render GetLastError() (or an explicit code) as a trimmed message string
+std::string win32_error_message(DWORD error) {
+    LPSTR buffer = nullptr;
+    const DWORD length = FormatMessageA(
+        FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM |
+            FORMAT_MESSAGE_IGNORE_INSERTS,
+        nullptr, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
+        reinterpret_cast<LPSTR>(&buffer), 0, nullptr);
+
+    std::string message = length > 0 ? std::string(buffer, length) : std::string();
+    if (buffer != nullptr) {
+        LocalFree(buffer);
+    }
+    while (!message.empty() && (message.back() == '\r' || message.back() == '\n')) {
+        message.pop_back();
+    }
+    if (message.empty()) {
+        message = "error " + std::to_string(error);
+    }
+    return message;
+}
+
+ExecutionResult failure(DWORD error, const std::string& what) {
+    return ExecutionResult{.error_code = static_cast<int>(error),
+                           .exit_code = platform::EXIT_FAILURE_STATUS,
+                           .error_message = what + ": " + win32_error_message(error)};
+}
+
+// ----------------------------------------------------------------------------
+// Environment block cache
+// ----------------------------------------------------------------------------
+
+// Cached CreateProcess environment block, built around immutable snapshots
+// the same way as the POSIX EnvironmentCache: the current state is a
+// shared_ptr<const Snapshot> that writers replace wholesale and readers pin
+// with a refcount bump. The common spawn (inherit, no per-command entries)
+// passes the prebuilt double-NUL block straight to CreateProcess instead of
+// rebuilding it per launch.
+class Win32EnvironmentCache {
+  public:
+    struct Snapshot {
+        // "KEY=VALUE\0KEY=VALUE\0...\0" — the exact lpEnvironment layout
+        std::vector<char> block;
+        // Parallel decoded view for overlay construction
+        std::vector<std::pair<std::string, std::string>> vars;
+    };
+
+    static Win32EnvironmentCache& instance() {
+        static Win32EnvironmentCache instance;
+        return instance;
+    }
+
+    [[nodiscard]] std::shared_ptr<const Snapshot> snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return current_;
+    }
+
+    // Rebuild from the live process environment and publish atomically
+    void refresh() {
+        auto next = std::make_shared<Snapshot>();
+        if (LPCH env = GetEnvironmentStringsA(); env != nullptr) {
+            for (const char* entry = env; *entry != '\0';
+                 entry += std::strlen(entry) + 1) {
+                const char* eq = std::strchr(entry + 1, '=');  // skip cmd.exe "=C:" names
+                if (eq != nullptr) {
+                    next->vars.emplace_back(std::string(entry, eq), std::string(eq + 1));
+                }
+            }
+            FreeEnvironmentStringsA(env);
+        }
+        rebuild_block(*next);
+        std::lock_guard<std::mutex> lock(mutex_);
+        current_ = std::move(next);
+    }
+
+    // Environment block for a spawn with per-command entries: the snapshot's
+    // decoded view plus the overlay, flattened once. `env_inherit == false`
+    // uses exactly the command's entries.
+    [[nodiscard]] static std::vector<char> block_with_overlay(const Snapshot& snap,
+                                                              const Command& cmd) {
+        std::vector<std::pair<std::string, std::string>> merged;
+        if (cmd.env_inherit) {
+            merged = snap.vars;
+        }
+        for (const auto& [key, value] : cmd.env) {
+            auto it = std::find_if(merged.begin(), merged.end(), [&key](const auto& entry) {
+                return _stricmp(entry.first.c_str(), key.c_str()) == 0;
+            });
+            if (it != merged.end()) {
+                it->second = value;
+            } else {
+                merged.emplace_back(key, value);
+            }
+        }
+
+        Snapshot scratch;
+        scratch.vars = std::move(merged);
+        rebuild_block(scratch);
+        return std::move(scratch.block);
+    }
 
+  private:
+    Win32EnvironmentCache() { refresh(); }
 
-void printWindowsErrMsg(DWORD& error) {
-    error = GetLastError();
-    LPVOID lpMsgBuf;
-    FormatMessage(
-        FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
-        NULL, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), (LPTSTR)&lpMsgBuf, 0, NULL);
+    static void rebuild_block(Snapshot& snap) {
+        // CreateProcess docs want the block sorted case-insensitively
+        std::sort(snap.vars.begin(), snap.vars.end(), [](const auto& a, const auto& b) {
+            return _stricmp(a.first.c_str(), b.first.c_str()) < 0;
+        });
+        snap.block.clear();
+        for (const auto& [key, value] : snap.vars) {
+            snap.block.insert(snap.block.end(), key.begin(), key.end());
+            snap.block.push_back('=');
+            snap.block.insert(snap.block.end(), value.begin(), value.end());
+            snap.block.push_back('\0');
+        }
+        snap.block.push_back('\0');  // double-NUL terminator
+    }
 
-    // Display the error
-    fprintf(stderr, "%s\n", (LPTSTR)lpMsgBuf);
+    mutable std::mutex mutex_;
+    std::shared_ptr<const Snapshot> current_;
+};
 
-    // Free the buffer allocated by FormatMessage
-    LocalFree(lpMsgBuf);
+// Environment block for a spawn. `env_snapshot` pins the cached block;
+// `overlay_block` backs the pointer when the command carries its own
+// entries. Both must outlive the CreateProcess call.
+LPVOID spawn_environment(const Command& cmd,
+                         std::shared_ptr<const Win32EnvironmentCache::Snapshot>& env_snapshot,
+                         std::vector<char>& overlay_block) {
+    env_snapshot = Win32EnvironmentCache::instance().snapshot();
+    if (cmd.env_inherit && cmd.env.empty()) {
+        return const_cast<char*>(env_snapshot->block.data());
+    }
+    overlay_block = Win32EnvironmentCache::block_with_overlay(*env_snapshot, cmd);
+    return overlay_block.data();
 }
 
-ExecutionResult PlatformExecutionPolicy::execute(const Command& cmd) const {
-    // Build command line (Windows uses a single string, not argv array)
-    std::ostringstream cmdline;
-    cmdline << cmd.executable.string();
+// ----------------------------------------------------------------------------
+// Command-line construction
+// ----------------------------------------------------------------------------
+
+// Quote one argument per the MSVCRT parsing rules CreateProcess children
+// apply: wrap in quotes when needed, double backslash runs that precede a
+// quote, and escape embedded quotes
+void append_quoted_argument(std::string& cmdline, const std::string& arg) {
+    const bool needs_quotes =
+        arg.empty() || arg.find_first_of(" \t\"") != std::string::npos;
+    if (!needs_quotes) {
+        cmdline += arg;
+        return;
+    }
+    cmdline += '"';
+    std::size_t backslashes = 0;
+    for (const char c : arg) {
+        if (c == '\\') {
+            ++backslashes;
+            continue;
+        }
+        if (c == '"') {
+            cmdline.append(backslashes * 2 + 1, '\\');
+        } else {
+            cmdline.append(backslashes, '\\');
+        }
+        backslashes = 0;
+        cmdline += c;
+    }
+    cmdline.append(backslashes * 2, '\\');  // trailing run precedes closing quote
+    cmdline += '"';
+}
+
+std::string build_command_line(const Command& cmd) {
+    std::string cmdline;
+    append_quoted_argument(cmdline, cmd.executable.string());
     for (const auto& arg : cmd.args) {
-        cmdline << " " << arg.value;
+        cmdline += ' ';
+        append_quoted_argument(cmdline, arg.value);
     }
-    std::string cmdline_str = cmdline.str();
+    return cmdline;
+}
+
+// ----------------------------------------------------------------------------
+// Stdio wiring
+// ----------------------------------------------------------------------------
 
-    // Setup process startup info
+// Inheritable stdio handles for one spawn; handles opened here (files, NUL)
+// are closed when the guard goes out of scope, after CreateProcess has
+// duplicated them into the child
+struct StdioHandles {
+    HANDLE in{GetStdHandle(STD_INPUT_HANDLE)};
+    HANDLE out{GetStdHandle(STD_OUTPUT_HANDLE)};
+    HANDLE err{GetStdHandle(STD_ERROR_HANDLE)};
+    std::vector<HANDLE> owned;
+
+    StdioHandles() = default;
+    StdioHandles(const StdioHandles&) = delete;
+    StdioHandles& operator=(const StdioHandles&) = delete;
+
+    ~StdioHandles() {
+        for (HANDLE handle : owned) {
+            CloseHandle(handle);
+        }
+    }
+};
+
+// Open an inheritable handle for a FileTarget/NullTarget endpoint; Inherit
+// keeps the preset console handle. Pipe/capture endpoints are wired by the
+// callers that own the pipes. Returns false (with `error` set) on failure.
+bool apply_stdio(const IO& io, HANDLE& slot, bool for_input, StdioHandles& stdio,
+                 DWORD& error) {
+    SECURITY_ATTRIBUTES inheritable{};
+    inheritable.nLength = sizeof(inheritable);
+    inheritable.bInheritHandle = TRUE;
+
+    if (std::holds_alternative<NullTarget>(io)) {
+        HANDLE nul = CreateFileA("NUL", for_input ? GENERIC_READ : GENERIC_WRITE,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE, &inheritable,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (nul == INVALID_HANDLE_VALUE) {
+            error = GetLastError();
+            return false;
+        }
+        stdio.owned.push_back(nul);
+        slot = nul;
+        return true;
+    }
+    if (!std::holds_alternative<FileTarget>(io)) {
+        return true;  // InheritTarget: console handles stay as preset
+    }
+
+    const auto& file_target = std::get<FileTarget>(io);
+    DWORD access = GENERIC_WRITE;
+    DWORD disposition = CREATE_ALWAYS;
+    switch (file_target.mode) {
+        case OpenMode::Read:
+            access = GENERIC_READ;
+            disposition = OPEN_EXISTING;
+            break;
+        case OpenMode::WriteAppend:
+            access = FILE_APPEND_DATA;
+            disposition = OPEN_ALWAYS;
+            break;
+        case OpenMode::WriteTruncate:
+        default:
+            break;
+    }
+    HANDLE file = CreateFileA(file_target.path.string().c_str(), access,
+                              FILE_SHARE_READ, &inheritable, disposition,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = GetLastError();
+        return false;
+    }
+    stdio.owned.push_back(file);
+    slot = file;
+    return true;
+}
+
+// Read a capture pipe to EOF, appending into `buffer`. 64 KiB chunks match
+// the POSIX drain loop; anonymous pipes are synchronous, so concurrent
+// streams each get their own drain (see execute below).
+void drain_pipe(HANDLE pipe, std::string& buffer) {
+    constexpr DWORD CHUNK = 64 * 1024;
+    for (;;) {
+        const std::size_t old_size = buffer.size();
+        buffer.resize(old_size + CHUNK);
+        DWORD read = 0;
+        const BOOL ok = ReadFile(pipe, buffer.data() + old_size, CHUNK, &read, nullptr);
+        buffer.resize(old_size + read);
+        if (!ok || read == 0) {
+            break;  // ERROR_BROKEN_PIPE == writer gone == EOF
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Spawning
+// ----------------------------------------------------------------------------
+
+// CreateProcess with the cached environment block and the given stdio
+// handles. On success the PROCESS_INFORMATION handles belong to the caller.
+std::optional<ExecutionResult> spawn(const Command& cmd, HANDLE in, HANDLE out, HANDLE err,
+                                     DWORD creation_flags, PROCESS_INFORMATION& pi) {
     STARTUPINFOA si{};
     si.cb = sizeof(si);
     si.dwFlags = STARTF_USESTDHANDLES;
-    si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
-    si.hStdOutput = GetStdHandle(STD_OUTPUT_HANDLE);
-    si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+    si.hStdInput = in;
+    si.hStdOutput = out;
+    si.hStdError = err;
+
+    // CreateProcessA modifies the command line in place; give it a copy
+    std::string cmdline = build_command_line(cmd);
+
+    std::shared_ptr<const Win32EnvironmentCache::Snapshot> env_snapshot;
+    std::vector<char> overlay_block;
+    LPVOID environment = spawn_environment(cmd, env_snapshot, overlay_block);
+
+    std::string work_dir;
+    LPCSTR work_dir_ptr = nullptr;
+    if (cmd.work_dir.has_value()) {
+        work_dir = cmd.work_dir->string();
+        work_dir_ptr = work_dir.c_str();
+    }
+
+    if (!CreateProcessA(nullptr, cmdline.data(), nullptr, nullptr,
+                        /*bInheritHandles=*/TRUE, creation_flags, environment,
+                        work_dir_ptr, &si, &pi)) {
+        return failure(GetLastError(),
+                       "Failed to create process '" + cmd.executable.string() + "'");
+    }
+    return std::nullopt;
+}
 
+int decode_exit_code(HANDLE process) {
+    DWORD exit_code = platform::EXIT_FAILURE_STATUS;
+    if (!GetExitCodeProcess(process, &exit_code)) {
+        return platform::EXIT_FAILURE_STATUS;
+    }
+    return static_cast<int>(exit_code);
+}
+
+// ----------------------------------------------------------------------------
+// Background job bookkeeping
+// ----------------------------------------------------------------------------
+
+// All background jobs are assigned to one kill-on-close Job Object so they
+// cannot outlive the shell, and their process handles are kept in a registry
+// so try_wait() polls the original handle instead of re-opening the pid
+// (which races with pid reuse).
+class BackgroundJobs {
+  public:
+    static BackgroundJobs& instance() {
+        static BackgroundJobs instance;
+        return instance;
+    }
+
+    [[nodiscard]] HANDLE job_object() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (job_ == nullptr) {
+            job_ = CreateJobObjectW(nullptr, nullptr);
+            if (job_ != nullptr) {
+                JOBOBJECT_EXTENDED_LIMIT_INFORMATION limits{};
+                limits.BasicLimitInformation.LimitFlags =
+                    JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+                SetInformationJobObject(job_, JobObjectExtendedLimitInformation, &limits,
+                                        sizeof(limits));
+            }
+        }
+        return job_;
+    }
+
+    void track(platform::ProcessId pid, HANDLE process) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        processes_[pid] = process;
+    }
+
+    // Non-blocking completion poll; on exit the handle is closed and the
+    // entry dropped. Unknown pids fall back to OpenProcess.
+    [[nodiscard]] std::optional<ExecutionResult> poll(platform::ProcessId pid) {
+        HANDLE process = nullptr;
+        bool tracked = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (auto it = processes_.find(pid); it != processes_.end()) {
+                process = it->second;
+                tracked = true;
+            }
+        }
+        if (!tracked) {
+            process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | SYNCHRONIZE,
+                                  FALSE, pid);
+            if (process == nullptr) {
+                // Already gone and never tracked: report a plain failure exit
+                return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
+                                       .error_message = std::nullopt};
+            }
+        }
+
+        if (WaitForSingleObject(process, 0) == WAIT_TIMEOUT) {
+            if (!tracked) {
+                CloseHandle(process);
+            }
+            return std::nullopt;  // still running
+        }
+
+        const int exit_code = decode_exit_code(process);
+        CloseHandle(process);
+        if (tracked) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            processes_.erase(pid);
+        }
+        return ExecutionResult{.exit_code = exit_code, .error_message = std::nullopt};
+    }
+
+  private:
+    BackgroundJobs() = default;
+
+    std::mutex mutex_;
+    HANDLE job_{nullptr};  // intentionally process-lifetime
+    std::unordered_map<platform::ProcessId, HANDLE> processes_;
+};
+
+}  // namespace
+
+std::expected<platform::ProcessId, std::string>
+PlatformExecutionPolicy::execute_async(const Command& cmd) const {
+    // Background launches mirror the POSIX policy: plain redirections only
+    // (pipes and captures need a waiting parent)
+    auto simple_io = [](const IO& io) {
+        return std::holds_alternative<InheritTarget>(io) ||
+               std::holds_alternative<FileTarget>(io) ||
+               std::holds_alternative<NullTarget>(io);
+    };
+    if (!simple_io(cmd.stdin_) || !simple_io(cmd.stdout_) || !simple_io(cmd.stderr_)) {
+        return std::unexpected("Cannot run in background: unsupported I/O redirection");
+    }
+
+    StdioHandles stdio;
+    DWORD error = 0;
+    if (!apply_stdio(cmd.stdin_, stdio.in, true, stdio, error) ||
+        !apply_stdio(cmd.stdout_, stdio.out, false, stdio, error) ||
+        !apply_stdio(cmd.stderr_, stdio.err, false, stdio, error)) {
+        return std::unexpected("Failed to set up redirection: " +
+                               win32_error_message(error));
+    }
+
+    // Spawn suspended so the child joins the kill-on-close Job Object
+    // before it runs — the Windows analogue of leading a fresh process
+    // group, and what makes reaping and shell-exit cleanup identical
     PROCESS_INFORMATION pi{};
+    if (auto err_result = spawn(cmd, stdio.in, stdio.out, stdio.err,
+                                CREATE_SUSPENDED | CREATE_NEW_PROCESS_GROUP, pi)) {
+        return std::unexpected(
+            err_result->error_message.value_or("Failed to create process"));
+    }
 
-    // Create process
-    // Note: CreateProcessA modifies the command line, so we need a mutable copy
-    std::vector<char> cmdline_buf(cmdline_str.begin(), cmdline_str.end());
-    cmdline_buf.push_back('\0');
+    if (HANDLE job = BackgroundJobs::instance().job_object(); job != nullptr) {
+        (void)AssignProcessToJobObject(job, pi.hProcess);
+    }
+    ResumeThread(pi.hThread);
+    CloseHandle(pi.hThread);
 
-    BOOL success = CreateProcessA(nullptr,             // Application name (use command line)
-                                  cmdline_buf.data(),  // Command line
-                                  nullptr,             // Process security attributes
-                                  nullptr,             // Thread security attributes
-                                  TRUE,                // Inherit handles
-                                  0,                   // Creation flags
-                                  nullptr,             // Environment
-                                  nullptr,             // Current directory
-                                  &si,                 // Startup info
-                                  &pi                  // Process information
-    );
+    BackgroundJobs::instance().track(pi.dwProcessId, pi.hProcess);
+    return pi.dwProcessId;
+}
+
+std::optional<ExecutionResult> PlatformExecutionPolicy::try_wait(platform::ProcessId pid) {
+    return BackgroundJobs::instance().poll(pid);
+}
 
-    if (!success) {
-        DWORD error;
+bool PlatformExecutionPolicy::sigchld_pending() {
+    // No SIGCHLD on Windows; callers poll
+    return true;
+}
 
-        printWindowsErrMsg(error);
+ExecutionResult PlatformExecutionPolicy::execute(const Command& cmd) const {
+    // Spawn+wait latency feeds the `stats` builtin's "spawn" histogram
+    StageTimer timer(Stage::Spawn);
 
-        return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
-                               .error_message = "Failed to create process (error " +
-                                                std::to_string(error) + ")"};
+    StdioHandles stdio;
+    DWORD error = 0;
+    if (!apply_stdio(cmd.stdin_, stdio.in, true, stdio, error) ||
+        !apply_stdio(cmd.stdout_, stdio.out, false, stdio, error) ||
+        !apply_stdio(cmd.stderr_, stdio.err, false, stdio, error)) {
+        return failure(error, "Failed to set up redirection");
     }
 
-    // Wait for process to complete
-    WaitForSingleObject(pi.hProcess, INFINITE);
+    // CaptureTarget endpoints: one anonymous pipe per captured stream, the
+    // child's write end inheritable, the parent's read end not
+    const bool capture_out = std::holds_alternative<CaptureTarget>(cmd.stdout_);
+    const bool capture_err = std::holds_alternative<CaptureTarget>(cmd.stderr_);
+    HANDLE out_read = nullptr;
+    HANDLE err_read = nullptr;
+    SECURITY_ATTRIBUTES inheritable{};
+    inheritable.nLength = sizeof(inheritable);
+    inheritable.bInheritHandle = TRUE;
+    if (capture_out) {
+        HANDLE write_end = nullptr;
+        if (!CreatePipe(&out_read, &write_end, &inheritable, 0)) {
+            return failure(GetLastError(), "Failed to create capture pipe");
+        }
+        SetHandleInformation(out_read, HANDLE_FLAG_INHERIT, 0);
+        stdio.owned.push_back(write_end);
+        stdio.out = write_end;
+    }
+    if (capture_err) {
+        HANDLE write_end = nullptr;
+        if (!CreatePipe(&err_read, &write_end, &inheritable, 0)) {
+            const DWORD saved = GetLastError();
+            if (out_read != nullptr) {
+                CloseHandle(out_read);
+            }
+            return failure(saved, "Failed to create capture pipe");
+        }
+        SetHandleInformation(err_read, HANDLE_FLAG_INHERIT, 0);
+        stdio.owned.push_back(write_end);
+        stdio.err = write_end;
+    }
 
-    // Get exit code
-    DWORD exit_code = platform::EXIT_FAILURE_STATUS;
-    GetExitCodeProcess(pi.hProcess, &exit_code);
+    PROCESS_INFORMATION pi{};
+    if (auto err_result = spawn(cmd, stdio.in, stdio.out, stdio.err, 0, pi)) {
+        if (out_read != nullptr) {
+            CloseHandle(out_read);
+        }
+        if (err_read != nullptr) {
+            CloseHandle(err_read);
+        }
+        return *err_result;
+    }
+
+    // Close our copies of the write ends so the pipes report EOF when the
+    // child exits, then drain fully BEFORE waiting — waiting first would
+    // deadlock once the child fills a pipe nobody is reading. Anonymous
+    // pipes do not support overlapped reads, so when both streams are
+    // captured the second one drains on a helper thread.
+    for (HANDLE handle : stdio.owned) {
+        CloseHandle(handle);
+    }
+    stdio.owned.clear();
+
+    std::string out_buf = capture_out ? CaptureBufferPool::instance().acquire() : std::string{};
+    std::string err_buf = capture_err ? CaptureBufferPool::instance().acquire() : std::string{};
+    if (capture_out && capture_err) {
+        std::thread err_drain([&] { drain_pipe(err_read, err_buf); });
+        drain_pipe(out_read, out_buf);
+        err_drain.join();
+    } else if (capture_out) {
+        drain_pipe(out_read, out_buf);
+    } else if (capture_err) {
+        drain_pipe(err_read, err_buf);
+    }
+    if (out_read != nullptr) {
+        CloseHandle(out_read);
+    }
+    if (err_read != nullptr) {
+        CloseHandle(err_read);
+    }
 
-    // Clean up handles
+    WaitForSingleObject(pi.hProcess, INFINITE);
+    const int exit_code = decode_exit_code(pi.hProcess);
     CloseHandle(pi.hProcess);
     CloseHandle(pi.hThread);
 
-    return ExecutionResult{.exit_code = static_cast<int>(exit_code), .error_message = std::nullopt};
+    return ExecutionResult{.exit_code = exit_code,
+                           .error_message = std::nullopt,
+                           .captured_stdout = std::move(out_buf),
+                           .captured_stderr = std::move(err_buf)};
 }
 
 ExecutionResult PlatformExecutionPolicy::execute(const Pipeline& pipeline) const {
-    // Phase 1: No pipeline support yet - just execute first command
     if (pipeline.empty()) {
         return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
                                .error_message = "Empty pipeline"};
     }
+    if (pipeline.size() == 1) {
+        return execute(pipeline.commands[0]);
+    }
+
+    const std::size_t stage_count = pipeline.size();
+
+    // Wire stage i's stdout to stage i+1's stdin with anonymous pipes. All
+    // ends start non-inheritable; each spawn temporarily marks only the two
+    // ends that stage needs, so no stage inherits another stage's pipes
+    // (the Windows analogue of O_CLOEXEC plus per-stage dup2).
+    std::vector<std::array<HANDLE, 2>> pipes(stage_count - 1, {nullptr, nullptr});
+    auto close_all_pipes = [&pipes]() {
+        for (auto& p : pipes) {
+            for (HANDLE& handle : p) {
+                if (handle != nullptr) {
+                    CloseHandle(handle);
+                    handle = nullptr;
+                }
+            }
+        }
+    };
+    for (auto& p : pipes) {
+        if (!CreatePipe(&p[0], &p[1], nullptr, 0)) {
+            const DWORD saved = GetLastError();
+            close_all_pipes();
+            return failure(saved, "Failed to create pipe");
+        }
+    }
+
+    // One Job Object per pipeline plays the role of the POSIX process
+    // group: signalling/terminating the job addresses every stage at once
+    HANDLE job = CreateJobObjectW(nullptr, nullptr);
+
+    // Spawn every stage up front so they run concurrently
+    std::vector<HANDLE> process_handles;
+    process_handles.reserve(stage_count);
+    std::optional<std::string> spawn_error;
 
-    // For now, just execute the first command
-    // Phase 2 will add proper pipeline support
-    return execute(pipeline.commands[0]);
+    for (std::size_t i = 0; i < stage_count; ++i) {
+        const Command& cmd = pipeline.commands[i];
+
+        StdioHandles stdio;
+        DWORD error = 0;
+        bool io_ok = true;
+        if (i == 0) {
+            io_ok = apply_stdio(cmd.stdin_, stdio.in, true, stdio, error);
+        } else {
+            stdio.in = pipes[i - 1][0];
+            SetHandleInformation(stdio.in, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT);
+        }
+        if (io_ok && i + 1 < stage_count) {
+            stdio.out = pipes[i][1];
+            SetHandleInformation(stdio.out, HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT);
+        } else if (io_ok) {
+            io_ok = apply_stdio(cmd.stdout_, stdio.out, false, stdio, error);
+        }
+        if (io_ok) {
+            io_ok = apply_stdio(cmd.stderr_, stdio.err, false, stdio, error);
+        }
+        if (!io_ok) {
+            spawn_error = "Failed to set up pipeline redirection: " +
+                          win32_error_message(error);
+            break;
+        }
+
+        PROCESS_INFORMATION pi{};
+        auto err_result = spawn(cmd, stdio.in, stdio.out, stdio.err, 0, pi);
+
+        // Revert inheritability immediately so later spawns don't leak
+        // these ends into their children
+        if (i > 0) {
+            SetHandleInformation(pipes[i - 1][0], HANDLE_FLAG_INHERIT, 0);
+        }
+        if (i + 1 < stage_count) {
+            SetHandleInformation(pipes[i][1], HANDLE_FLAG_INHERIT, 0);
+        }
+
+        if (err_result.has_value()) {
+            spawn_error = err_result->error_message;
+            break;
+        }
+        if (job != nullptr) {
+            (void)AssignProcessToJobObject(job, pi.hProcess);
+        }
+        CloseHandle(pi.hThread);
+        process_handles.push_back(pi.hProcess);
+    }
+
+    // Parent no longer needs any pipe end once all stages are spawned;
+    // closing them delivers EOF to the stages correctly
+    close_all_pipes();
+
+    // Reap every spawned stage; the pipeline's exit code is the last stage's
+    int exit_code = platform::EXIT_FAILURE_STATUS;
+    for (std::size_t i = 0; i < process_handles.size(); ++i) {
+        WaitForSingleObject(process_handles[i], INFINITE);
+        if (i + 1 == stage_count) {
+            exit_code = decode_exit_code(process_handles[i]);
+        }
+        CloseHandle(process_handles[i]);
+    }
+    if (job != nullptr) {
+        CloseHandle(job);
+    }
+
+    if (spawn_error.has_value()) {
+        return ExecutionResult{.exit_code = platform::EXIT_FAILURE_STATUS,
+                               .error_message = spawn_error};
+    }
+    return ExecutionResult{.exit_code = exit_code, .error_message = std::nullopt};
 }
 
 void PlatformExecutionPolicy::init_job_control() const {
-    // Windows doesn't have POSIX-style job control
-    // Would use Job Objects here if needed
+    // Materialize the kill-on-close Job Object up front so the first
+    // background launch doesn't pay for it; completion is poll-based
+    // (sigchld_pending always reports "maybe"), same as a POSIX build
+    // without the SIGCHLD handler.
+    (void)BackgroundJobs::instance().job_object();
+}
+
+void PlatformExecutionPolicy::prescan_path() {
+    // CreateProcessA performs its own PATH search; no cache to pre-warm here
 }
 
 }  // namespace wshell
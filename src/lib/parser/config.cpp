@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <iomanip>
 #include <iostream>
 #ifdef _WIN32
     #include <stdlib.h>
@@ -62,7 +63,7 @@ bool StrictValidationPolicy::check_limits(std::size_t name_len, std::size_t valu
 template <typename ValidationPolicy>
 void Config<ValidationPolicy>::showEnvironmentVariables() {
     std::ranges::for_each(variables_, [](auto const& kv) {
-        std::cout << std::format("{:<20} = {}\n", kv.first, kv.second);
+        std::cout << std::left << std::setw(20) << kv.first << " = " << kv.second << "\n";
     });
 }
 
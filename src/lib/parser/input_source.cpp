@@ -6,13 +6,28 @@
 #include <fstream>
 #include <sstream>
 
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
 namespace wshell {
 
 //==============================================================================
 // FileInputSource Implementation
 //==============================================================================
 
-FileInputSource::FileInputSource(std::filesystem::path path) : path_(std::move(path)) {}
+FileInputSource::FileInputSource(std::filesystem::path path, std::size_t max_file_size)
+    : path_(std::move(path)), max_file_size_(max_file_size) {}
+
+FileInputSource::~FileInputSource() {
+#ifndef _WIN32
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
 
 std::expected<std::string, std::string> FileInputSource::read() {
     // Check file existence
@@ -21,14 +36,15 @@ std::expected<std::string, std::string> FileInputSource::read() {
         return std::unexpected("File not found: " + path_.string());
     }
 
-    // Security: Check file size before reading
+    // Security: Check file size before reading (policy; UNLIMITED disables)
     auto file_size = std::filesystem::file_size(path_, ec);
     if (ec) {
         return std::unexpected("Cannot determine file size: " + ec.message());
     }
 
-    if (file_size > MAX_FILE_SIZE) {
-        return std::unexpected("File exceeds maximum size (1MB)");
+    if (max_file_size_ != UNLIMITED && file_size > max_file_size_) {
+        return std::unexpected("File exceeds maximum size (" +
+                               std::to_string(max_file_size_) + " bytes)");
     }
 
     // Read file content
@@ -47,6 +63,57 @@ std::expected<std::string, std::string> FileInputSource::read() {
     return buffer.str();
 }
 
+std::expected<std::string_view, std::string> FileInputSource::read_view() {
+    // Re-reading just hands back the existing view
+    if (mapping_ != nullptr) {
+        return std::string_view{static_cast<const char*>(mapping_), mapping_size_};
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::exists(path_, ec)) {
+        return std::unexpected("File not found: " + path_.string());
+    }
+
+    auto file_size = std::filesystem::file_size(path_, ec);
+    if (ec) {
+        return std::unexpected("Cannot determine file size: " + ec.message());
+    }
+
+    if (max_file_size_ != UNLIMITED && file_size > max_file_size_) {
+        return std::unexpected("File exceeds maximum size (" +
+                               std::to_string(max_file_size_) + " bytes)");
+    }
+
+    if (file_size == 0) {
+        return std::string_view{};
+    }
+
+#ifndef _WIN32
+    int fd = open(path_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::unexpected("Cannot open file: " + path_.string());
+    }
+
+    void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping keeps the file alive
+    if (mapped == MAP_FAILED) {
+        return std::unexpected("Cannot map file: " + path_.string());
+    }
+
+    mapping_ = mapped;
+    mapping_size_ = file_size;
+    return std::string_view{static_cast<const char*>(mapping_), mapping_size_};
+#else
+    // No mmap: fall back to a single owned read and view that
+    auto content = read();
+    if (!content) {
+        return std::unexpected(content.error());
+    }
+    fallback_content_ = std::move(*content);
+    return std::string_view{fallback_content_};
+#endif
+}
+
 std::string FileInputSource::source_name() const {
     return path_.string();
 }
@@ -109,6 +176,77 @@ std::string StreamInputSource::source_name() const {
     return name_;
 }
 
+//==============================================================================
+// ReadaheadInputSource Implementation
+//==============================================================================
+
+ReadaheadInputSource::ReadaheadInputSource(IInputSource& inner,
+                                           std::size_t max_buffered_lines)
+    : inner_(inner),
+      max_buffered_lines_(max_buffered_lines == 0 ? DEFAULT_MAX_BUFFERED_LINES
+                                                  : max_buffered_lines),
+      reader_([this] { reader_loop(); }) {}
+
+ReadaheadInputSource::~ReadaheadInputSource() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    not_full_.notify_all();
+    if (reader_.joinable()) {
+        reader_.join();
+    }
+}
+
+void ReadaheadInputSource::reader_loop() {
+    while (true) {
+        // Pull the next line outside the lock so consumers keep draining
+        auto line = inner_.read_line();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stop_) {
+            return;
+        }
+        if (!line) {
+            // EOF or error ends the session: report it after the buffered
+            // lines are drained, then stay sticky
+            terminal_error_ = std::move(line.error());
+            done_ = true;
+            not_empty_.notify_all();
+            return;
+        }
+
+        not_full_.wait(lock,
+                       [this] { return lines_.size() < max_buffered_lines_ || stop_; });
+        if (stop_) {
+            return;
+        }
+        lines_.push_back(std::move(*line));
+        not_empty_.notify_one();
+    }
+}
+
+std::expected<std::string, std::string> ReadaheadInputSource::read() {
+    return inner_.read();
+}
+
+std::expected<std::string, std::string> ReadaheadInputSource::read_line() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !lines_.empty() || done_; });
+    if (lines_.empty()) {
+        return std::unexpected(terminal_error_);
+    }
+    std::string line = std::move(lines_.front());
+    lines_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return line;
+}
+
+std::string ReadaheadInputSource::source_name() const {
+    return inner_.source_name() + " (readahead)";
+}
+
 //==============================================================================
 // StringInputSource Implementation
 //==============================================================================
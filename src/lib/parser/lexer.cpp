@@ -3,10 +3,33 @@
 
 #include "shell/lexer.hpp"
 
+#include <array>
 #include <cctype>
+#include <cstring>
 
 namespace wshell {
 
+namespace {
+
+// 256-entry classification table: true for bytes that terminate a WORD
+// (whitespace plus shell operator metacharacters). A table lookup keeps the
+// word scan below a tight, vectorizable loop instead of two predicate calls
+// per byte.
+constexpr std::array<bool, 256> make_word_delimiter_table() {
+    std::array<bool, 256> table{};
+    for (unsigned char ch : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+        table[ch] = true;
+    }
+    for (unsigned char ch : {'=', '#', '|', '&', ';', '<', '>'}) {
+        table[ch] = true;
+    }
+    return table;
+}
+
+constexpr auto kWordDelimiter = make_word_delimiter_table();
+
+}  // namespace
+
 char Lexer::current() const noexcept {
     if (is_at_end())
         return '\0';
@@ -33,28 +56,40 @@ void Lexer::advance() noexcept {
 }
 
 void Lexer::skip_whitespace() {
-    while (!is_at_end() && (current() == ' ' || current() == '\t')) {
-        advance();
+    // Bulk scan: blanks never include '\n', so only the column moves
+    const char* data = source_.data();
+    const std::size_t size = source_.size();
+    std::size_t pos = position_;
+    while (pos < size && (data[pos] == ' ' || data[pos] == '\t')) {
+        ++pos;
     }
+    column_ += pos - position_;
+    position_ = pos;
 }
 
-Token Lexer::make_token(TokenType type, std::string value) {
-    return Token(type, std::move(value), line_, column_);
+Token Lexer::make_token(TokenType type, std::string_view value) {
+    return Token(type, value, line_, column_);
 }
 
 Token Lexer::lex_comment() {
     std::size_t start = position_;
     advance();  // Skip '#'
 
-    while (!is_at_end() && current() != '\n') {
-        advance();
-    }
+    // memchr kernel: jump straight to the terminating newline (or EOF).
+    // Comments never span lines, so only the column moves.
+    const char* data = source_.data();
+    const std::size_t size = source_.size();
+    const char* newline =
+        static_cast<const char*>(std::memchr(data + position_, '\n', size - position_));
+    const std::size_t end = newline ? static_cast<std::size_t>(newline - data) : size;
+    column_ += end - position_;
+    position_ = end;
 
-    std::string comment_text(source_.substr(start + 1, position_ - start - 1));
+    std::string_view comment_text = source_.substr(start + 1, position_ - start - 1);
 
     // Trim exactly one leading space
     if (!comment_text.empty() && comment_text[0] == ' ') {
-        comment_text.erase(0, 1);
+        comment_text.remove_prefix(1);
     }
 
     return make_token(TokenType::Comment, comment_text);
@@ -67,17 +102,44 @@ Token Lexer::lex_comment() {
 Token Lexer::lex_word() {
     std::size_t start = position_;
 
-    auto is_operator = [&](char ch) {
-        return ch == '=' || ch == '#' || ch == '|' || ch == '&' || ch == ';' || ch == '<' ||
-               ch == '>';
-    };
-
-    while (!is_at_end() && !std::isspace(static_cast<unsigned char>(current())) &&
-           !is_operator(current())) {
-        advance();
+    // Table-driven kernel: scan to the next delimiter byte in one tight
+    // loop. A WORD never contains '\n' (it is a delimiter), so only the
+    // column moves. Inside a $(...) command substitution the delimiter
+    // table is suspended (the inner command may contain spaces and
+    // operators) until the matching ')'; an unterminated substitution
+    // falls back to ending the word at the newline.
+    const char* data = source_.data();
+    const std::size_t size = source_.size();
+    std::size_t pos = position_;
+    int subst_depth = 0;
+    while (pos < size) {
+        const char ch = data[pos];
+        if (subst_depth > 0) {
+            if (ch == '\n') {
+                break;
+            }
+            if (ch == ')') {
+                --subst_depth;
+            } else if (ch == '(') {
+                ++subst_depth;
+            }
+            ++pos;
+            continue;
+        }
+        if (ch == '$' && pos + 1 < size && data[pos + 1] == '(') {
+            subst_depth = 1;
+            pos += 2;
+            continue;
+        }
+        if (kWordDelimiter[static_cast<unsigned char>(ch)]) {
+            break;
+        }
+        ++pos;
     }
+    column_ += pos - position_;
+    position_ = pos;
 
-    std::string text(source_.substr(start, position_ - start));
+    std::string_view text = source_.substr(start, position_ - start);
 
     // Keyword check
     if (text == "let") {
@@ -183,4 +245,45 @@ std::vector<Token> Lexer::tokenize(std::string_view source) {
     return tokens;
 }
 
+TokenBuffer Lexer::tokenize_buffer(std::string_view source) {
+    TokenBuffer buffer;
+
+    // Allocation 1: the char pool (a stable copy of the source text)
+    buffer.pool_ = std::make_unique<char[]>(source.size());
+    if (!source.empty()) {
+        std::memcpy(buffer.pool_.get(), source.data(), source.size());
+    }
+    buffer.pool_size_ = source.size();
+
+    const std::string_view pooled = buffer.text();
+
+    // Counting pass: size the token array exactly so the fill pass below
+    // never reallocates.
+    std::size_t count = 0;
+    {
+        Lexer counter(pooled);
+        while (true) {
+            Token token = counter.next_token();
+            ++count;
+            if (token.type == TokenType::EndOfFile) {
+                break;
+            }
+        }
+    }
+
+    // Allocation 2: the contiguous token array
+    buffer.tokens_.reserve(count);
+
+    Lexer lexer(pooled);
+    while (true) {
+        Token token = lexer.next_token();
+        buffer.tokens_.push_back(token);
+        if (token.type == TokenType::EndOfFile) {
+            break;
+        }
+    }
+
+    return buffer;
+}
+
 }  // namespace wshell
\ No newline at end of file
@@ -3,8 +3,16 @@
 
 #include "shell/output_destination.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 
+#ifndef _WIN32
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
 namespace wshell {
 
 //==============================================================================
@@ -112,4 +120,155 @@ std::string FileOutputDestination::destination_name() const {
     return path_.string();
 }
 
+//==============================================================================
+// BufferedOutputDestination Implementation
+//==============================================================================
+
+BufferedOutputDestination::BufferedOutputDestination(IOutputDestination& inner,
+                                                     std::size_t chunk_size)
+    : inner_(inner), chunk_size_(chunk_size == 0 ? DEFAULT_CHUNK_SIZE : chunk_size) {
+    buffer_.reserve(chunk_size_);
+}
+
+BufferedOutputDestination::~BufferedOutputDestination() {
+    // Best effort: nothing useful to do with an error during destruction
+    (void)flush();
+}
+
+std::expected<void, std::string> BufferedOutputDestination::drain() {
+    if (buffer_.empty()) {
+        return {};
+    }
+
+    auto result = inner_.write(buffer_);
+    buffer_.clear();
+    return result;
+}
+
+std::expected<void, std::string> BufferedOutputDestination::write(std::string_view content) {
+    // Oversized pieces skip the buffer entirely rather than being chopped up
+    if (content.size() >= chunk_size_) {
+        if (auto result = drain(); !result) {
+            return result;
+        }
+        return inner_.write(content);
+    }
+
+    if (buffer_.size() + content.size() > chunk_size_) {
+        if (auto result = drain(); !result) {
+            return result;
+        }
+    }
+
+    buffer_.append(content);
+    return {};
+}
+
+std::expected<void, std::string>
+BufferedOutputDestination::write_many(std::span<const std::string_view> pieces) {
+    for (auto piece : pieces) {
+        if (auto result = write(piece); !result) {
+            return result;
+        }
+    }
+    return {};
+}
+
+std::expected<void, std::string> BufferedOutputDestination::flush() {
+    if (auto result = drain(); !result) {
+        return result;
+    }
+    return inner_.flush();
+}
+
+std::string BufferedOutputDestination::destination_name() const {
+    return inner_.destination_name() + " (buffered)";
+}
+
+#ifndef _WIN32
+
+//==============================================================================
+// FdOutputDestination Implementation
+//==============================================================================
+
+FdOutputDestination::FdOutputDestination(int fd, std::string name)
+    : fd_(fd), name_(std::move(name)) {}
+
+std::expected<void, std::string> FdOutputDestination::write(std::string_view content) {
+    while (!content.empty()) {
+        ssize_t written = ::write(fd_, content.data(), content.size());
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return std::unexpected("Failed to write to " + name_ + ": " +
+                                   std::strerror(errno));
+        }
+        content.remove_prefix(static_cast<std::size_t>(written));
+    }
+    return {};
+}
+
+std::expected<void, std::string>
+FdOutputDestination::write_many(std::span<const std::string_view> pieces) {
+    // One writev() per batch; IOV_MAX-sized batches are far beyond anything
+    // the shell emits, so fall back to chunks of kMaxIov just in case.
+    static constexpr std::size_t kMaxIov = 64;
+
+    while (!pieces.empty()) {
+        iovec iov[kMaxIov];
+        std::size_t count = std::min(pieces.size(), kMaxIov);
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            iov[i].iov_base = const_cast<char*>(pieces[i].data());
+            iov[i].iov_len = pieces[i].size();
+            total += pieces[i].size();
+        }
+
+        std::size_t done = 0;
+        while (done < total) {
+            ssize_t written = ::writev(fd_, iov, static_cast<int>(count));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return std::unexpected("Failed to write to " + name_ + ": " +
+                                       std::strerror(errno));
+            }
+            done += static_cast<std::size_t>(written);
+            if (done < total) {
+                // Partial write: skip fully-written pieces, trim the rest
+                std::size_t skip = static_cast<std::size_t>(written);
+                std::size_t first = 0;
+                while (first < count && skip >= iov[first].iov_len) {
+                    skip -= iov[first].iov_len;
+                    ++first;
+                }
+                if (first < count && skip > 0) {
+                    iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + skip;
+                    iov[first].iov_len -= skip;
+                }
+                std::move(iov + first, iov + count, iov);
+                count -= first;
+                total -= static_cast<std::size_t>(written);
+                done = 0;
+            }
+        }
+
+        pieces = pieces.subspan(std::min(pieces.size(), kMaxIov));
+    }
+    return {};
+}
+
+std::expected<void, std::string> FdOutputDestination::flush() {
+    // Unbuffered: every write goes straight to the kernel
+    return {};
+}
+
+std::string FdOutputDestination::destination_name() const {
+    return name_;
+}
+
+#endif  // !_WIN32
+
 }  // namespace wshell
@@ -7,16 +7,51 @@
 #include "shell/ast.hpp"
 #include "shell/ast_printer.hpp"
 #include "shell/lexer.hpp"
+#include "shell/output_destination.hpp"
+#include "shell/string_pool.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <variant>
 
 #include <utility>
 
 namespace wshell {
 
+// -----------------------------------------------------------------------------
+// AST trace facility (opt-in; off by default so parsing does zero I/O)
+// -----------------------------------------------------------------------------
+
 namespace {
+IOutputDestination* ast_trace_sink = nullptr;
+}  // namespace
+
+void set_ast_trace_sink(IOutputDestination* sink) {
+    ast_trace_sink = sink;
+}
+
+void trace_ast(const ProgramNode& program) {
+    if (ast_trace_sink != nullptr) {
+        (void)ast_trace_sink->write(to_string(program));
+    }
+}
+
+namespace {
+
+// Only words that can actually reference a variable need the expansion pass
+bool word_needs_expansion(std::string_view text) {
+    return text.find('$') != std::string_view::npos;
+}
+
+// All word text goes through the shared interning pool: repeated words
+// across lines (command names, flags, paths) resolve to one stable copy,
+// so Word carries a view instead of an owned string
+std::string_view intern_word(std::string_view text) {
+    return StringPool::instance().intern(text);
+}
 
-RedirectKind redirect_kind_from_lexeme(const std::string& s) {
+RedirectKind redirect_kind_from_lexeme(std::string_view s) {
     if (s == ">")
         return RedirectKind::OutputTruncate;
     if (s == ">>")
@@ -30,29 +65,60 @@ RedirectKind redirect_kind_from_lexeme(const std::string& s) {
 // Token helpers
 // -----------------------------------------------------------------------------
 
-Token Parser::peek_token() {
-    return lexer_.peek_token();
+// Pull one raw token from the underlying source (token span or lexer).
+// Only fill_ring calls this, so each token is lexed exactly once.
+Token Parser::fetch_token() {
+    if (token_mode_) {
+        if (cursor_ < tokens_.size()) {
+            return tokens_[cursor_++];
+        }
+        return Token{TokenType::EndOfFile};
+    }
+    return lexer_.next_token();
+}
+
+void Parser::fill_ring(std::size_t needed) {
+    while (ring_count_ < needed) {
+        ring_[(ring_head_ + ring_count_) % LOOKAHEAD] = fetch_token();
+        ++ring_count_;
+    }
+}
+
+const Token& Parser::peek_ahead(std::size_t n) {
+    fill_ring(n + 1);
+    return ring_[(ring_head_ + n) % LOOKAHEAD];
 }
 
-Token Parser::current_token() {
-    return lexer_.peek_token();
+const Token& Parser::peek_token() {
+    return peek_ahead(0);
+}
+
+Token Parser::next_token() {
+    fill_ring(1);
+    Token consumed = ring_[ring_head_];
+    ring_head_ = (ring_head_ + 1) % LOOKAHEAD;
+    --ring_count_;
+    return consumed;
+}
+
+const Token& Parser::current_token() {
+    return peek_token();
 }
 
 bool Parser::check(TokenType type) {
-    return lexer_.peek_token().type == type;
+    return peek_token().type == type;
 }
 
 bool Parser::match(TokenType type) {
-    Token t = lexer_.peek_token();
-    if (t.type == type) {
-        (void)lexer_.next_token();  // consume
+    if (peek_token().type == type) {
+        (void)next_token();  // consume
         return true;
     }
     return false;
 }
 
 void Parser::advance() {
-    (void)lexer_.next_token();
+    (void)next_token();
 }
 
 void Parser::skip_newlines() {
@@ -75,8 +141,8 @@ std::expected<CommentNode, ParseError> Parser::parse_comment() {
         return std::unexpected(make_error(ParseErrorKind::SyntaxError, "Expected comment"));
     }
 
-    Token tok = lexer_.next_token();  // consume the comment token
-    return make_comment(tok.value);
+    Token tok = next_token();  // consume the comment token
+    return make_comment(std::string(tok.value));
 }
 
 // -----------------------------------------------------------------------------
@@ -95,8 +161,8 @@ std::expected<AssignmentNode, ParseError> Parser::parse_assignment() {
             make_error(ParseErrorKind::SyntaxError, "Expected variable name after 'let'"));
     }
     Token var_tok = current_token();
-    std::string variable = var_tok.value;
-    (void)lexer_.next_token();  // consume identifier
+    std::string variable{var_tok.value};
+    (void)next_token();  // consume identifier
 
     // '='
     if (!match(TokenType::Equals)) {
@@ -123,7 +189,7 @@ std::expected<AssignmentNode, ParseError> Parser::parse_assignment() {
         if (!first) value.push_back(' ');
         first = false;
         value += t.value;
-        (void)lexer_.next_token();  // consume
+        (void)next_token();  // consume
     }
     return make_assignment(std::move(variable), std::move(value));
 }
@@ -138,7 +204,7 @@ std::expected<Redirection, ParseError> Parser::parse_redirection() {
             make_error(ParseErrorKind::SyntaxError, "Expected redirection operator"));
     }
 
-    Token op = lexer_.next_token();  // consume operator
+    Token op = next_token();  // consume operator
 
     // Detect incomplete input: "cmd >" or "cmd <"
     if (check(TokenType::EndOfFile) || check(TokenType::Newline)) {
@@ -159,9 +225,9 @@ std::expected<Redirection, ParseError> Parser::parse_redirection() {
             make_error(ParseErrorKind::SyntaxError, "Expected redirection target"));
     }
 
-    // For now, treat all redirection targets as unquoted, needs_expansion=true
-    Word target_word{target.value, false, true};
-    (void)lexer_.next_token();  // consume target
+    // Redirection targets are unquoted; expansion only if they reference a variable
+    Word target_word{intern_word(target.value), false, word_needs_expansion(target.value)};
+    (void)next_token();  // consume target
 
     return Redirection{redirect_kind_from_lexeme(op.value), std::move(target_word)};
 }
@@ -176,11 +242,11 @@ std::expected<CommandNode, ParseError> Parser::parse_simple_command() {
         return std::unexpected(make_error(ParseErrorKind::SyntaxError, "Expected command name"));
     }
 
-    // Command name as Word (unquoted, needs_expansion=true)
-    Word name_word{cmd_tok.value, false, true};
-    std::vector<Word> args;
+    // Command name as Word (unquoted; expansion only if it references a variable)
+    Word name_word{intern_word(cmd_tok.value), false, word_needs_expansion(cmd_tok.value)};
+    std::pmr::vector<Word> args{arena_};
 
-    (void)lexer_.next_token();  // consume the command name
+    (void)next_token();  // consume the command name
 
     // collect arguments until a control token
     while (!check(TokenType::Newline) && !check(TokenType::EndOfFile) && !check(TokenType::Pipe) &&
@@ -188,7 +254,7 @@ std::expected<CommandNode, ParseError> Parser::parse_simple_command() {
            !check(TokenType::Redirect)) {
         Token t = current_token();
         if (t.type == TokenType::Identifier || t.type == TokenType::Equals) {
-            std::string val = t.value;
+            std::string val{t.value};
             bool is_quoted = false;
             // Handle quoted arguments (may contain spaces or nested quotes)
             if (!val.empty() && val.front() == '"') {
@@ -202,7 +268,7 @@ std::expected<CommandNode, ParseError> Parser::parse_simple_command() {
                         break;
                     }
                     // Otherwise, add a space and next token
-                    (void)lexer_.next_token();
+                    (void)next_token();
                     if (check(TokenType::Newline) || check(TokenType::EndOfFile) || check(TokenType::Pipe) ||
                         check(TokenType::Semicolon) || check(TokenType::Background) || check(TokenType::Redirect)) {
                         // Unterminated quote, treat as is
@@ -213,14 +279,15 @@ std::expected<CommandNode, ParseError> Parser::parse_simple_command() {
                     val += next.value;
                 }
             }
-            args.emplace_back(val, is_quoted, true);
-            (void)lexer_.next_token();  // consume the argument (or last part of quoted)
+            args.emplace_back(intern_word(val), is_quoted, word_needs_expansion(val));
+            (void)next_token();  // consume the argument (or last part of quoted)
         } else {
             break;
         }
     }
 
-    return make_command(std::move(name_word), std::move(args));
+    return make_command(std::move(name_word), std::move(args),
+                        std::pmr::vector<Redirection>{arena_});
 }
 
 // -----------------------------------------------------------------------------
@@ -262,12 +329,13 @@ std::expected<StatementNode, ParseError> Parser::parse_pipeline() {
         return std::unexpected(first.error());
     }
 
-    std::vector<CommandNode> cmds;
+    std::pmr::vector<CommandNode> cmds{arena_};
     cmds.push_back(std::move(*first));
 
     while (check(TokenType::Pipe)) {
         Token pipe_tok = peek_token();
         auto lexer_state = lexer_;
+        const auto cursor_state = cursor_;  // token-mode equivalent
         (void)match(TokenType::Pipe);  // consume '|'
 
         // Skip comments after a pipe
@@ -300,6 +368,7 @@ std::expected<StatementNode, ParseError> Parser::parse_pipeline() {
                 return std::unexpected(next.error());
             }
             lexer_ = lexer_state;
+            cursor_ = cursor_state;
             break;
         }
         cmds.push_back(std::move(*next));
@@ -329,7 +398,7 @@ std::expected<StatementNode, ParseError> Parser::parse_list() {
     }
 
     // There is at least one ';' → build a SequenceNode.
-    std::vector<StatementNode> stmts;
+    std::pmr::vector<StatementNode> stmts{arena_};
     stmts.push_back(std::move(*first_pipe));
 
     while (match(TokenType::Semicolon)) {
@@ -338,11 +407,17 @@ std::expected<StatementNode, ParseError> Parser::parse_list() {
             break;
         }
 
+        // Inside a for-loop body, 'done' closes the loop rather than
+        // starting another command
+        if (at_for_terminator()) {
+            break;
+        }
+
         // If the next token is a pipe, treat as syntax error (matches Bash)
         if (check(TokenType::Pipe)) {
             Token op_tok = peek_token();
             return std::unexpected(ParseError{ParseErrorKind::SyntaxError,
-                                              "Syntax error: unexpected '" + op_tok.value + "' after ';'",
+                                              "Syntax error: unexpected '" + std::string(op_tok.value) + "' after ';'",
                                               op_tok.line, op_tok.column, std::source_location::current()});
         }
 
@@ -358,7 +433,7 @@ std::expected<StatementNode, ParseError> Parser::parse_list() {
         if (check(TokenType::Pipe)) {
             Token op_tok = peek_token();
             return std::unexpected(ParseError{ParseErrorKind::SyntaxError,
-                                              "Syntax error: unexpected '" + op_tok.value + "' after statement",
+                                              "Syntax error: unexpected '" + std::string(op_tok.value) + "' after statement",
                                               op_tok.line, op_tok.column, std::source_location::current()});
         }
 
@@ -369,6 +444,170 @@ std::expected<StatementNode, ParseError> Parser::parse_list() {
     return StatementNode{std::move(seq)};
 }
 
+// -----------------------------------------------------------------------------
+// For loop: 'for' VAR 'in' WORD* ['par' [N]] 'do' statement* 'done'
+//
+// Keywords are plain identifiers recognized positionally (the lexer has no
+// keyword tokens beyond 'let'), so commands named "for" are shadowed the
+// same way real shells shadow their reserved words. A missing 'do'/'done'
+// at end of input reports IncompleteInput so the REPL can prompt for
+// continuation lines instead of failing the statement.
+// -----------------------------------------------------------------------------
+
+// True when the next token is the contextual 'done' keyword closing the
+// for-loop body currently being parsed
+bool Parser::at_for_terminator() {
+    return for_body_depth_ > 0 && check(TokenType::Identifier) &&
+           current_token().value == "done";
+}
+
+std::expected<ForNode, ParseError> Parser::parse_for_loop() {
+    (void)next_token();  // consume 'for'
+
+    Token var_tok = current_token();
+    if (var_tok.type != TokenType::Identifier) {
+        return std::unexpected(
+            make_error(ParseErrorKind::SyntaxError, "Expected variable name after 'for'"));
+    }
+    std::string variable{var_tok.value};
+    (void)next_token();
+
+    Token in_tok = current_token();
+    if (in_tok.type != TokenType::Identifier || in_tok.value != "in") {
+        return std::unexpected(
+            make_error(ParseErrorKind::SyntaxError, "Expected 'in' after for-loop variable"));
+    }
+    (void)next_token();
+
+    ForNode loop{.variable = std::move(variable),
+                 .values = std::pmr::vector<Word>{arena_},
+                 .body = std::pmr::vector<StatementNode>{arena_},
+                 .parallel = false,
+                 .max_jobs = 0};
+
+    // Value list: words up to 'par'/'do' or a separator
+    while (check(TokenType::Identifier)) {
+        Token t = current_token();
+        if (t.value == "do" || t.value == "par") {
+            break;
+        }
+        loop.values.emplace_back(intern_word(t.value), false, word_needs_expansion(t.value));
+        (void)next_token();
+    }
+
+    // Optional parallel marker with an optional job bound: 'par' / 'par 4'
+    if (check(TokenType::Identifier) && current_token().value == "par") {
+        loop.parallel = true;
+        (void)next_token();
+        Token jobs_tok = current_token();
+        if (jobs_tok.type == TokenType::Identifier && !jobs_tok.value.empty() &&
+            std::all_of(jobs_tok.value.begin(), jobs_tok.value.end(),
+                        [](unsigned char c) { return std::isdigit(c); })) {
+            // from_chars rejects overflow without throwing; a bound too big
+            // for size_t is malformed input, not a reason to abort the shell
+            std::size_t jobs = 0;
+            auto [ptr, ec] = std::from_chars(
+                jobs_tok.value.data(), jobs_tok.value.data() + jobs_tok.value.size(), jobs);
+            if (ec != std::errc{} || ptr != jobs_tok.value.data() + jobs_tok.value.size()) {
+                return std::unexpected(make_error(ParseErrorKind::SyntaxError,
+                                                  "Parallel job bound out of range"));
+            }
+            loop.max_jobs = jobs;
+            (void)next_token();
+        }
+    }
+
+    // Separators before 'do' (newlines and/or semicolons)
+    while (match(TokenType::Newline) || match(TokenType::Semicolon)) {
+    }
+    if (check(TokenType::EndOfFile)) {
+        return std::unexpected(
+            make_error(ParseErrorKind::IncompleteInput, "Expected 'do' in for loop"));
+    }
+    Token do_tok = current_token();
+    if (do_tok.type != TokenType::Identifier || do_tok.value != "do") {
+        return std::unexpected(make_error(ParseErrorKind::SyntaxError, "Expected 'do' in for loop"));
+    }
+    (void)next_token();
+
+    if (auto body = parse_do_block(loop.body); !body) {
+        return std::unexpected(body.error());
+    }
+
+    return loop;
+}
+
+// -----------------------------------------------------------------------------
+// Do-block body: statement* 'done' (the 'do' keyword is consumed by the
+// caller). Shared by for loops and function definitions. The depth counter
+// makes statement lists inside the body yield at the contextual 'done'.
+// -----------------------------------------------------------------------------
+
+std::expected<void, ParseError> Parser::parse_do_block(std::pmr::vector<StatementNode>& body) {
+    ++for_body_depth_;
+    while (true) {
+        while (match(TokenType::Newline) || match(TokenType::Semicolon)) {
+        }
+        if (check(TokenType::EndOfFile)) {
+            --for_body_depth_;
+            return std::unexpected(
+                make_error(ParseErrorKind::IncompleteInput, "Expected 'done' to close block"));
+        }
+        if (check(TokenType::Identifier) && current_token().value == "done") {
+            (void)next_token();
+            break;
+        }
+        auto stmt = parse_statement();
+        if (!stmt) {
+            --for_body_depth_;
+            return std::unexpected(stmt.error());
+        }
+        body.push_back(std::move(*stmt));
+    }
+    --for_body_depth_;
+    return {};
+}
+
+// -----------------------------------------------------------------------------
+// Function definition: 'function' NAME 'do' statement* 'done'
+//
+// Same contextual-keyword treatment as the for loop; the body is stored
+// verbatim and registered with the interpreter when the definition
+// statement executes.
+// -----------------------------------------------------------------------------
+
+std::expected<FunctionNode, ParseError> Parser::parse_function() {
+    (void)next_token();  // consume 'function'
+
+    Token name_tok = current_token();
+    if (name_tok.type != TokenType::Identifier) {
+        return std::unexpected(
+            make_error(ParseErrorKind::SyntaxError, "Expected function name after 'function'"));
+    }
+    FunctionNode fn{.name = std::string(name_tok.value),
+                    .body = std::pmr::vector<StatementNode>{arena_}};
+    (void)next_token();
+
+    while (match(TokenType::Newline) || match(TokenType::Semicolon)) {
+    }
+    if (check(TokenType::EndOfFile)) {
+        return std::unexpected(
+            make_error(ParseErrorKind::IncompleteInput, "Expected 'do' in function definition"));
+    }
+    Token do_tok = current_token();
+    if (do_tok.type != TokenType::Identifier || do_tok.value != "do") {
+        return std::unexpected(
+            make_error(ParseErrorKind::SyntaxError, "Expected 'do' in function definition"));
+    }
+    (void)next_token();
+
+    if (auto body = parse_do_block(fn.body); !body) {
+        return std::unexpected(body.error());
+    }
+
+    return fn;
+}
+
 // -----------------------------------------------------------------------------
 // Statement: comment | assignment | list(pipeline/sequence/command)
 // -----------------------------------------------------------------------------
@@ -398,13 +637,16 @@ std::expected<StatementNode, ParseError> Parser::parse_statement() {
         // If next token is semicolon or command, parse as sequence (let assignment; ...)
         if (check(TokenType::Semicolon)) {
             // Parse the rest of the sequence
-            std::vector<StatementNode> stmts;
+            std::pmr::vector<StatementNode> stmts{arena_};
             stmts.push_back(StatementNode{std::move(*a)});
             while (match(TokenType::Semicolon)) {
                 // Allow trailing semicolon (Bash: ok)
                 if (check(TokenType::EndOfFile) || check(TokenType::Newline)) {
                     break;
                 }
+                if (at_for_terminator()) {
+                    break;
+                }
                 auto next = parse_list();
                 if (!next) {
                     return std::unexpected(next.error());
@@ -422,6 +664,24 @@ std::expected<StatementNode, ParseError> Parser::parse_statement() {
         }
     }
 
+    // For loop
+    if (check(TokenType::Identifier) && current_token().value == "for") {
+        auto loop = parse_for_loop();
+        if (!loop) {
+            return std::unexpected(loop.error());
+        }
+        return StatementNode{std::move(*loop)};
+    }
+
+    // Function definition
+    if (check(TokenType::Identifier) && current_token().value == "function") {
+        auto fn = parse_function();
+        if (!fn) {
+            return std::unexpected(fn.error());
+        }
+        return StatementNode{std::move(*fn)};
+    }
+
     // Command / Pipeline / Sequence
     auto list = parse_list();
     if (!list) {
@@ -436,7 +696,7 @@ std::expected<StatementNode, ParseError> Parser::parse_statement() {
 // -----------------------------------------------------------------------------
 
 std::expected<std::unique_ptr<ProgramNode>, ParseError> Parser::parse_program() {
-    auto program = std::make_unique<ProgramNode>();
+    auto program = std::make_unique<ProgramNode>(arena_);
 
     skip_newlines();
 
@@ -452,11 +712,28 @@ std::expected<std::unique_ptr<ProgramNode>, ParseError> Parser::parse_program()
     return program;
 }
 
+// -----------------------------------------------------------------------------
+// parse_next_statement: streaming interface (one statement per call)
+// -----------------------------------------------------------------------------
+std::expected<std::optional<StatementNode>, ParseError> Parser::parse_next_statement() {
+    skip_newlines();
+
+    if (check(TokenType::EndOfFile)) {
+        return std::optional<StatementNode>{};  // clean end of input
+    }
+
+    auto stmt = parse_statement();
+    if (!stmt) {
+        return std::unexpected(stmt.error());
+    }
+    return std::optional<StatementNode>{std::move(*stmt)};
+}
+
 // -----------------------------------------------------------------------------
 // parse_line: a single logical line (for REPL)
 // -----------------------------------------------------------------------------
 std::expected<std::unique_ptr<ProgramNode>, ParseError> Parser::parse_line() {
-    auto program = std::make_unique<ProgramNode>();
+    auto program = std::make_unique<ProgramNode>(arena_);
 
     // Empty input is fine
     if (check(TokenType::EndOfFile) || check(TokenType::Newline)) {
@@ -479,15 +756,15 @@ std::expected<std::unique_ptr<ProgramNode>, ParseError> Parser::parse_line() {
 
     // Allow a single trailing newline
     if (check(TokenType::Newline)) {
-        (void)lexer_.next_token();
+        (void)next_token();
     }
 
     // Allow a single trailing semicolon (with or without whitespace)
     if (check(TokenType::Semicolon)) {
-        (void)lexer_.next_token();
+        (void)next_token();
         // Allow trailing whitespace (newlines) after semicolon
         while (check(TokenType::Newline)) {
-            (void)lexer_.next_token();
+            (void)next_token();
         }
     }
 
@@ -502,4 +779,43 @@ std::expected<std::unique_ptr<ProgramNode>, ParseError> Parser::parse_line() {
     return program;
 }
 
+// -----------------------------------------------------------------------------
+// ParserSession: incremental continuation parsing
+// -----------------------------------------------------------------------------
+
+std::expected<std::unique_ptr<ProgramNode>, ParseError>
+ParserSession::feed(std::string_view line) {
+    const std::size_t line_offset = lines_.size();
+    // Deque storage keeps earlier lines at stable addresses, so the cached
+    // tokens' value views stay valid as more lines arrive
+    lines_.emplace_back(line);
+
+    // Lex only the new line. The previous line's EndOfFile becomes the
+    // newline that separates the two lines in the combined stream.
+    auto line_tokens = Lexer::tokenize(lines_.back());
+    if (!tokens_.empty() && tokens_.back().type == TokenType::EndOfFile) {
+        tokens_.back() =
+            Token{TokenType::Newline, "\n", tokens_.back().line, tokens_.back().column};
+    }
+    tokens_.reserve(tokens_.size() + line_tokens.size());
+    for (Token token : line_tokens) {
+        token.line += line_offset;  // session-relative line numbers in errors
+        tokens_.push_back(token);
+    }
+
+    // Re-parse is a cursor walk over the cached tokens; no character-level
+    // work from earlier lines is repeated
+    Parser parser(std::span<const Token>(tokens_.data(), tokens_.size()), arena_);
+    auto result = parser.parse_line();
+    if (result.has_value()) {
+        trace_ast(*result.value());
+    }
+    return result;
+}
+
+void ParserSession::reset() {
+    lines_.clear();
+    tokens_.clear();
+}
+
 }  // namespace wshell
\ No newline at end of file
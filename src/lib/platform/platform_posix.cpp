@@ -2,6 +2,8 @@
 #include "shell/platform.h"
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/wait.h>
+#include <cerrno>
 #include <signal.h>
 #include <pwd.h>
 #include <limits.h>
@@ -26,6 +28,32 @@ bool terminate_process(int pid) {
     return kill(pid, SIGTERM) == 0;
 }
 
+std::optional<int> wait_for_process(int pid) {
+    int status = 0;
+    pid_t rc;
+    do {
+        rc = waitpid(pid, &status, 0);
+    } while (rc < 0 && errno == EINTR);
+    if (rc < 0) {
+        return std::nullopt;
+    }
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    if (WIFSIGNALED(status)) {
+        return 128 + WTERMSIG(status);
+    }
+    return std::nullopt;
+}
+
+bool continue_process_group(int pgid) {
+    return kill(-pgid, SIGCONT) == 0;
+}
+
+
+bool stdin_is_interactive() {
+    return isatty(STDIN_FILENO) == 1;
+}
 
 std::optional<std::string> get_home_directory() {
     const char* home = getenv("HOME");
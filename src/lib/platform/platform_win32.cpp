@@ -5,6 +5,7 @@
 #include <optional>
 
 #include <direct.h>
+#include <io.h>
 #include <filesystem>
 
 namespace wshell {
@@ -29,6 +30,30 @@ bool terminate_process(int pid) {
     return result != 0;
 }
 
+std::optional<int> wait_for_process(int pid) {
+    HANDLE hProcess =
+        OpenProcess(SYNCHRONIZE | PROCESS_QUERY_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (!hProcess) return std::nullopt;
+    DWORD exit_code = 1;
+    std::optional<int> result;
+    if (WaitForSingleObject(hProcess, INFINITE) == WAIT_OBJECT_0 &&
+        GetExitCodeProcess(hProcess, &exit_code)) {
+        result = static_cast<int>(exit_code);
+    }
+    CloseHandle(hProcess);
+    return result;
+}
+
+bool continue_process_group(int pgid) {
+    // Windows has no SIGCONT equivalent at this layer
+    (void)pgid;
+    return false;
+}
+
+bool stdin_is_interactive() {
+    return _isatty(_fileno(stdin)) != 0;
+}
+
 
 std::optional<std::string> get_home_directory() {
     char* home = nullptr;
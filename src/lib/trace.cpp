@@ -0,0 +1,25 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/trace.hpp"
+
+#include "shell/output_destination.hpp"
+
+namespace wshell {
+
+namespace {
+IOutputDestination* exec_trace_sink = nullptr;
+}  // namespace
+
+void set_exec_trace_sink(IOutputDestination* sink) {
+    exec_trace_sink = sink;
+}
+
+void exec_trace_write(std::string_view message) {
+    if (exec_trace_sink != nullptr) {
+        const std::string_view pieces[] = {message, "\n"};
+        (void)exec_trace_sink->write_many(pieces);
+    }
+}
+
+}  // namespace wshell
@@ -1,25 +1,104 @@
 // Copyright (c) 2024 William Sollers
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include "shell/alloc_stats.hpp"
 #include "shell/config.hpp"
+#include "shell/config_watcher.hpp"
+#include "shell/line_editor.hpp"
 #include "shell/parser.hpp"
+#include "shell/plan_cache.hpp"
 #include "shell/shell_interpreter.hpp"
 #include "shell/shell_process_context.h"
+#include "shell/trace.hpp"
 
 #include <span>
 
+#include <cstdlib>
 #include <iostream>
+#include <memory_resource>
+#include <optional>
 #include <string>
 
+#include "shell/platform.h"
+
 #include "version.hpp"
 #include <shell/output_destination.hpp>
 
-int main(int argc, char* argv[]) {
-    std::cout << "wshell version " << wshell::version() << "\n";
+namespace {
+
+/// Execute a script file, parsing statement-at-a-time so the first statement
+/// runs as soon as it is parsed and memory stays flat for huge scripts.
+int run_script(const std::filesystem::path& script_path) {
+    wshell::FileInputSource file(script_path, wshell::FileInputSource::UNLIMITED);
+    // Zero-copy ingestion: the mapping's pages stream in on demand as the
+    // lexer advances, so the whole text is never materialized
+    auto content = file.read_view();
+    if (!content) {
+        std::cerr << "wshell: " << script_path.string() << ": " << content.error() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
+    wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
+    wshell::ShellInterpreter<wshell::PlatformExecutionPolicy> interpreter(stdout_dest,
+                                                                          stderr_dest);
+    if constexpr (wshell::kExecTraceCompiledIn) {
+        wshell::set_exec_trace_sink(&stderr_dest);
+    }
+
+    // One statement's AST lives in the arena only until it has executed;
+    // the counting decorator attributes every node allocation to the AST
+    // site for `stats` / --mem-stats
+    std::pmr::monotonic_buffer_resource ast_arena;
+    wshell::CountingMemoryResource counted_arena(&ast_arena, wshell::AllocSite::Ast);
+    wshell::Parser parser(*content, false, &counted_arena);
 
+    int exit_code = EXIT_SUCCESS;
+    while (true) {
+        auto stmt = parser.parse_next_statement();
+        if (!stmt) {
+            (void)stderr_dest.write(stmt.error().to_string() + "\n");
+            return EXIT_FAILURE;
+        }
+        if (!stmt->has_value()) {
+            break;  // clean end of script
+        }
+        {
+            wshell::ProgramNode program(&counted_arena);
+            program.add_statement(std::move(**stmt));
+            exit_code = interpreter.execute_program(program);
+        }
+        ast_arena.release();
+    }
+    return exit_code;
+}
+
+/// --mem-stats exit report: one line per site plus a total, on stderr so
+/// it never mixes with script output
+void print_mem_stats() {
+    std::cerr << "wshell memory stats (allocs / bytes):\n";
+    for (std::size_t i = 0; i < wshell::kAllocSiteCount; ++i) {
+        const auto site = static_cast<wshell::AllocSite>(i);
+        const auto snap = wshell::AllocStats::instance().snapshot(site);
+        std::cerr << "  " << wshell::alloc_site_name(site) << ": " << snap.count << " / "
+                  << snap.bytes << "\n";
+    }
+    const auto total = wshell::AllocStats::instance().total();
+    std::cerr << "  total: " << total.count << " / " << total.bytes << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
     ShellProcessContext ctx = ShellProcessContext();
     ctx.argc = argc;
     ctx.argv = argv;
+    (void)ctx;
+
+    // Scripted invocations (stdin is a pipe/file) get a quiet, fast startup:
+    // no banner, no config notice — nothing lands on stdout except command
+    // output, and nothing optional runs before the first command
+    const bool interactive = wshell::stdin_is_interactive();
 
     // Load configuration from ~/.wshellrc
     auto config_path = wshell::DefaultConfig::default_config_path();
@@ -29,46 +108,143 @@ int main(int argc, char* argv[]) {
 
     wshell::Config config;
     if (std::filesystem::exists(config_path)) {
-        std::cout << "Loading configuration from " << config_path.string() << "\n";
-        wshell::FileInputSource* file_source = new wshell::FileInputSource(config_path);
-        auto config_result =
-            config.loadFromSource(std::unique_ptr<wshell::IInputSource>(file_source));
+        // Binary sidecar cache: hits skip text parsing and validation, which
+        // matters when CI spawns many short-lived shells
+        auto config_result = wshell::DefaultConfig::loadCached(config_path);
         if (!config_result) {
             std::cerr << "Error loading config: " << config_result.error().message << "\n";
+        } else {
+            config = std::move(*config_result);
         }
-        config.showEnvironmentVariables();
-    } else {
+    } else if (interactive) {
         std::cout << "No configuration file found at " << config_path.string() << "\n";
     }
 
+    // Optional one-time bulk PATH scan to pre-warm executable resolution
+    if (config.get("PRESCAN_PATH").value_or("0") == "1") {
+        wshell::PlatformExecutionPolicy::prescan_path();
+    }
+
     std::span<char*> args(argv, static_cast<std::size_t>(argc));
     // parse args and set flags
     auto command_args = args.subspan(1);
 
+    // --mem-stats: dump the per-subsystem allocation counters on exit
+    bool mem_stats = false;
+    while (!command_args.empty() &&
+           std::string_view(command_args.front()) == "--mem-stats") {
+        mem_stats = true;
+        command_args = command_args.subspan(1);
+    }
+
     if (!command_args.empty()) {
-        // parse args and set flags
+        // Script mode: wshell script.sh — statements execute as they parse
+        const int exit_code = run_script(command_args.front());
+        if (mem_stats) {
+            print_mem_stats();
+        }
+        return exit_code;
     } else {
-        wshell::StreamInputSource stdin_source(std::cin, "stdin");
+        // Banner only for a human at a terminal; piped batch sessions get
+        // straight to their first command
+        if (interactive) {
+            std::cout << "wshell version " << wshell::version() << "\n";
+        }
+
+        wshell::StreamInputSource stdin_stream(std::cin, "stdin");
         wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
         wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
 
-        auto prompt = config.get("PS1").value_or("wshell> ");
-        auto cont_prompt = config.get("PS2").value_or("> ");
+        // Batch mode (stdin is a pipe/file): read ahead on a background
+        // thread so executing command N overlaps with I/O for command N+1.
+        std::optional<wshell::ReadaheadInputSource> readahead;
+        wshell::IInputSource* stdin_source = &stdin_stream;
+        if (!interactive) {
+            readahead.emplace(stdin_stream);
+            stdin_source = &*readahead;
+        }
+
+        // Hot-reload: a background watcher republishes ~/.wshellrc as an
+        // immutable snapshot when it changes, so long-lived shells pick up
+        // new settings (PS1/PS2 below) without a restart — and without
+        // losing warm caches. Seeded from the startup parse above, so no
+        // re-parse happens here; the watch thread only runs for interactive
+        // sessions — batch sessions are short-lived and keep startup lean.
+        wshell::ConfigWatcher config_watcher(config_path, config.variables());
+        if (interactive) {
+            config_watcher.start();
+        }
 
         wshell::ShellInterpreter<wshell::PlatformExecutionPolicy> interpreter(stdout_dest,
                                                                               stderr_dest);
 
+#if !defined(_WIN32)
+        // Interactive terminals get the raw-mode line editor (cursor
+        // editing, Tab completion, history navigation/search) instead of
+        // the canonical-mode blocking read. The editor paints its own
+        // prompt, so the PS1/PS2 writes below are skipped when active.
+        std::optional<wshell::CompletionIndex> completion;
+        std::optional<wshell::LineEditorInputSource> line_editor;
+        if (interactive) {
+            const char* path_env = std::getenv("PATH");
+            completion.emplace(path_env != nullptr ? path_env : "");
+            line_editor.emplace(stdout_dest);
+            line_editor->editor().set_completion_index(&*completion);
+            line_editor->editor().set_history(&interpreter.history());
+            stdin_source = &*line_editor;
+        }
+        const bool editor_active = line_editor.has_value();
+#else
+        const bool editor_active = false;
+#endif
+
+        // Trace builds route execution tracing to stderr; production builds
+        // compile all of it out
+        if constexpr (wshell::kExecTraceCompiledIn) {
+            wshell::set_exec_trace_sink(&stderr_dest);
+        }
+
+        // Per-line AST arena: every parse bump-allocates from here and the
+        // whole block is recycled (not freed) after execution. The counting
+        // decorator attributes node allocations to the AST site.
+        std::pmr::monotonic_buffer_resource ast_arena;
+        wshell::CountingMemoryResource counted_arena(&ast_arena, wshell::AllocSite::Ast);
+
+        // Continuation session: each line is lexed once and its tokens are
+        // cached, so pasting an N-line construct costs O(N) lex work instead
+        // of re-lexing the whole accumulated buffer per line
+        wshell::ParserSession parse_session(&counted_arena);
+
+        // Repeated lines (orchestrated traffic) reuse their parsed program
+        // and skip lexing/parsing entirely
+        wshell::PlanCache plan_cache;
+
         while (true) {
             std::string full_input;
 
+            // Prompts come from the current config snapshot, pinned once
+            // per command so a mid-command reload can't mix PS1 and PS2
+            // from different config versions
+            const auto cfg = config_watcher.snapshot();
+            auto setting = [&cfg](const char* key, const char* fallback) {
+                auto it = cfg->find(key);
+                return it != cfg->end() ? it->second : std::string(fallback);
+            };
+            const std::string prompt = setting("PS1", "wshell> ");
+            const std::string cont_prompt = setting("PS2", "> ");
+
             // --- First prompt (PS1) ---
-            if (auto rc = stdout_dest.write(prompt); !rc) {
+            if (editor_active) {
+#if !defined(_WIN32)
+                line_editor->set_prompt(prompt);
+#endif
+            } else if (auto rc = stdout_dest.write(prompt); !rc) {
                 (void)stderr_dest.write("Error writing prompt: " + rc.error() + "\n");
                 break;
             }
 
             // Read first line
-            auto input = stdin_source.read_line();
+            auto input = stdin_source->read_line();
             if (!input) {
                 (void)stderr_dest.write("Error reading input: " + input.error() + "\n");
                 break;
@@ -86,49 +262,91 @@ int main(int argc, char* argv[]) {
                 continue;
             }
 
-            // --- Try parsing the line ---
-            auto parse_result = wshell::parse_line(full_input);
-
-            // --- Handle continuation ---
-            while (!parse_result &&
-                   parse_result.error().kind_ == wshell::ParseErrorKind::IncompleteInput) {
-                // Print continuation prompt (PS2)
-                if (auto rc = stdout_dest.write(cont_prompt); !rc) {
-                    (void)stderr_dest.write("Error writing prompt: " + rc.error() + "\n");
-                    break;
+            // Plan-cache hit: execute the memoized program directly
+            if (const auto* plan = plan_cache.lookup(full_input)) {
+                interpreter.addToHisttory(full_input);
+#if !defined(_WIN32)
+                if (completion) {
+                    completion->note_history(full_input);
+                }
+#endif
+                int exit_code = interpreter.execute_program(*plan);
+                if (exit_code != 0) {
+                    (void)stderr_dest.write("Command exited with code: " +
+                                            std::to_string(exit_code) + "\n");
                 }
+                continue;
+            }
 
-                auto next_line = stdin_source.read_line();
+            // Scope the AST so it is gone before the arena is recycled
+            {
+                // --- Try parsing the line ---
+                auto parse_result = parse_session.feed(full_input);
 
-                if (!next_line) {
-                    (void)stderr_dest.write("Error reading input: " + next_line.error() + "\n");
-                    break;
-                }
+                // --- Handle continuation ---
+                while (!parse_result &&
+                       parse_result.error().kind_ == wshell::ParseErrorKind::IncompleteInput) {
+                    // Print continuation prompt (PS2)
+                    if (editor_active) {
+#if !defined(_WIN32)
+                        line_editor->set_prompt(cont_prompt);
+#endif
+                    } else if (auto rc = stdout_dest.write(cont_prompt); !rc) {
+                        (void)stderr_dest.write("Error writing prompt: " + rc.error() + "\n");
+                        break;
+                    }
 
-                // OutputAppend with newline (important for multi-line constructs)
-                full_input += "\n";
-                full_input += *next_line;
+                    auto next_line = stdin_source->read_line();
 
-                // Try parsing again
-                parse_result = wshell::parse_line(full_input);
-            }
+                    if (!next_line) {
+                        (void)stderr_dest.write("Error reading input: " + next_line.error() + "\n");
+                        break;
+                    }
 
-            interpreter.addToHisttory(full_input);
+                    // Keep the full text for history (important for
+                    // multi-line constructs); only the new line is lexed
+                    full_input += "\n";
+                    full_input += *next_line;
 
-            // If still an error (but not incomplete), print it
-            if (!parse_result) {
-                (void)stderr_dest.write(parse_result.error().to_string() + "\n");
-                continue;
-            }
+                    // Try parsing again (cursor walk over cached tokens)
+                    parse_result = parse_session.feed(*next_line);
+                }
 
-            // --- Execute the parsed program ---
-            int exit_code = interpreter.execute_program(**parse_result);
+                interpreter.addToHisttory(full_input);
+#if !defined(_WIN32)
+                if (completion) {
+                    completion->note_history(full_input);
+                }
+#endif
+
+                if (!parse_result) {
+                    // If still an error (but not incomplete), print it
+                    (void)stderr_dest.write(parse_result.error().to_string() + "\n");
+                } else {
+                    // --- Execute the parsed program ---
+                    int exit_code = interpreter.execute_program(**parse_result);
+
+                    if (exit_code != 0) {
+                        (void)stderr_dest.write("Command exited with code: " +
+                                                std::to_string(exit_code) + "\n");
+                    }
 
-            if (exit_code != 0) {
-                (void)stderr_dest.write("Command exited with code: " + std::to_string(exit_code) +
-                                        "\n");
+                    // Memoize single-line statements so the next occurrence
+                    // of this exact line bypasses the front end
+                    if (parse_session.line_count() == 1) {
+                        plan_cache.memoize(full_input);
+                    }
+                }
             }
+
+            // Reclaim every AST allocation from this line in one step, and
+            // start the next statement from an empty session
+            parse_session.reset();
+            ast_arena.release();
         }
     }
+    if (mem_stats) {
+        print_mem_stats();
+    }
     return EXIT_SUCCESS;
 }
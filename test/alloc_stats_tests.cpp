@@ -0,0 +1,92 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/alloc_stats.hpp"
+#include "shell/parser.hpp"
+#include "shell/string_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <string>
+
+namespace {
+
+using wshell::AllocSite;
+using wshell::AllocStats;
+using wshell::CountingMemoryResource;
+
+class AllocStatsTest : public ::testing::Test {
+protected:
+    // AllocStats is process-wide; start each test from a clean slate
+    void SetUp() override { AllocStats::instance().reset(); }
+    void TearDown() override { AllocStats::instance().reset(); }
+};
+
+TEST_F(AllocStatsTest, RecordAccumulatesCountAndBytesPerSite) {
+    auto& stats = AllocStats::instance();
+    stats.record(AllocSite::Expansion, 100);
+    stats.record(AllocSite::Expansion, 28);
+    stats.record(AllocSite::History, 7);
+
+    const auto expansion = stats.snapshot(AllocSite::Expansion);
+    EXPECT_EQ(expansion.count, 2u);
+    EXPECT_EQ(expansion.bytes, 128u);
+
+    const auto history = stats.snapshot(AllocSite::History);
+    EXPECT_EQ(history.count, 1u);
+    EXPECT_EQ(history.bytes, 7u);
+
+    const auto total = stats.total();
+    EXPECT_EQ(total.count, 3u);
+    EXPECT_EQ(total.bytes, 135u);
+
+    stats.reset();
+    EXPECT_EQ(stats.total().count, 0u);
+}
+
+TEST_F(AllocStatsTest, CountingResourceAttributesForwardedAllocations) {
+    std::pmr::monotonic_buffer_resource arena;
+    CountingMemoryResource counted(&arena, AllocSite::Ast);
+
+    void* block = counted.allocate(64, 8);
+    counted.deallocate(block, 64, 8);
+
+    const auto snap = AllocStats::instance().snapshot(AllocSite::Ast);
+    EXPECT_EQ(snap.count, 1u);
+    EXPECT_EQ(snap.bytes, 64u);
+}
+
+TEST_F(AllocStatsTest, ParsingThroughCountedArenaChargesTheAstSite) {
+    std::pmr::monotonic_buffer_resource arena;
+    CountingMemoryResource counted(&arena, AllocSite::Ast);
+
+    wshell::Parser parser("echo one\necho two\n", false, &counted);
+    while (true) {
+        auto stmt = parser.parse_next_statement();
+        ASSERT_TRUE(stmt.has_value());
+        if (!stmt->has_value()) {
+            break;
+        }
+    }
+
+    EXPECT_GT(AllocStats::instance().snapshot(AllocSite::Ast).count, 0u);
+}
+
+TEST_F(AllocStatsTest, InterningChargesLexerOnlyOnFirstSight) {
+    auto& pool = wshell::StringPool::instance();
+    // A string this process has certainly never interned before
+    const std::string fresh =
+        "alloc-stats-test-" + std::to_string(::getpid()) + "-unique";
+
+    (void)pool.intern(fresh);
+    const auto first = AllocStats::instance().snapshot(AllocSite::Lexer);
+    EXPECT_GE(first.bytes, fresh.size());
+
+    (void)pool.intern(fresh);  // hash-consed hit: nothing new charged
+    const auto second = AllocStats::instance().snapshot(AllocSite::Lexer);
+    EXPECT_EQ(second.count, first.count);
+    EXPECT_EQ(second.bytes, first.bytes);
+}
+
+}  // namespace
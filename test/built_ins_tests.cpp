@@ -0,0 +1,40 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/built_ins.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using wshell::BuiltIns;
+using wshell::find_builtin_id;
+
+TEST(BuiltInsTest, FrozenTableFindsEveryRegisteredName) {
+    BuiltIns builtins;
+    for (const auto& [name, id] : wshell::kBuiltinNames) {
+        EXPECT_TRUE(find_builtin_id(name).has_value()) << name;
+        EXPECT_NE(builtins.find(name), nullptr) << name;
+    }
+}
+
+TEST(BuiltInsTest, UnknownCommandsAreNotBuiltins) {
+    BuiltIns builtins;
+    EXPECT_FALSE(find_builtin_id("ls").has_value());
+    EXPECT_FALSE(find_builtin_id("").has_value());
+    EXPECT_FALSE(find_builtin_id("histor").has_value());
+    EXPECT_FALSE(find_builtin_id("historyy").has_value());
+    EXPECT_EQ(builtins.find("ls"), nullptr);
+    EXPECT_FALSE(builtins.is_builtin_command("ls"));
+}
+
+TEST(BuiltInsTest, LookupTakesStringViewWithoutOwningKey) {
+    BuiltIns builtins;
+    // A view into a larger buffer must match without constructing a string
+    const std::string line = "pwd && ls";
+    const std::string_view cmd = std::string_view(line).substr(0, 3);
+    EXPECT_TRUE(builtins.is_builtin_command(cmd));
+    EXPECT_NE(builtins.find(cmd), nullptr);
+}
+
+}  // namespace
@@ -0,0 +1,78 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/capture_buffer.hpp"
+#include "shell/execution_policy.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using wshell::CaptureBufferPool;
+
+TEST(CaptureBufferPoolTest, AcquireComesPreReserved) {
+    auto buffer = CaptureBufferPool::instance().acquire();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_GE(buffer.capacity(), CaptureBufferPool::INITIAL_RESERVE);
+    CaptureBufferPool::instance().release(std::move(buffer));
+}
+
+TEST(CaptureBufferPoolTest, ReleasedCapacityIsReused) {
+    auto buffer = CaptureBufferPool::instance().acquire();
+    buffer.assign(256 * 1024, 'x');  // grow past the initial reservation
+    const auto grown_capacity = buffer.capacity();
+    CaptureBufferPool::instance().release(std::move(buffer));
+
+    auto reused = CaptureBufferPool::instance().acquire();
+    EXPECT_TRUE(reused.empty());
+    EXPECT_GE(reused.capacity(), grown_capacity);
+    CaptureBufferPool::instance().release(std::move(reused));
+}
+
+#if !defined(_WIN32)
+
+using wshell::PlatformExecutionPolicy;
+
+TEST(CaptureTargetTest, StdoutIsCapturedInMemory) {
+    auto cmd = wshell::make_simple_command("/bin/echo", {"captured", "bytes"});
+    cmd.stdout_ = wshell::capture();
+
+    PlatformExecutionPolicy policy;
+    auto result = policy.execute(cmd);
+
+    EXPECT_TRUE(result.is_success());
+    EXPECT_EQ(result.captured_stdout, "captured bytes\n");
+    EXPECT_TRUE(result.captured_stderr.empty());
+}
+
+TEST(CaptureTargetTest, StdoutAndStderrCaptureIndependently) {
+    auto cmd = wshell::make_simple_command(
+        "/bin/sh", {"-c", "echo out; echo err 1>&2; echo out2"});
+    cmd.stdout_ = wshell::capture();
+    cmd.stderr_ = wshell::capture();
+
+    PlatformExecutionPolicy policy;
+    auto result = policy.execute(cmd);
+
+    EXPECT_TRUE(result.is_success());
+    EXPECT_EQ(result.captured_stdout, "out\nout2\n");
+    EXPECT_EQ(result.captured_stderr, "err\n");
+}
+
+TEST(CaptureTargetTest, LargeOutputExceedingPipeCapacity) {
+    // 1 MiB >> the 64 KiB pipe buffer: the drain loop must keep reading
+    // while the child is still writing or both sides deadlock
+    auto cmd = wshell::make_simple_command(
+        "/bin/sh", {"-c", "head -c 1048576 /dev/zero | tr '\\0' 'a'"});
+    cmd.stdout_ = wshell::capture();
+
+    PlatformExecutionPolicy policy;
+    auto result = policy.execute(cmd);
+
+    EXPECT_TRUE(result.is_success());
+    EXPECT_EQ(result.captured_stdout.size(), 1048576u);
+}
+
+#endif  // !_WIN32
+
+}  // namespace
@@ -0,0 +1,84 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/ast.hpp"
+#include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+using namespace wshell;
+
+namespace {
+
+// The REPL executes plan-cached ProgramNodes repeatedly; these tests
+// re-execute one parsed program to exercise the routing cache the same way.
+
+TEST(CommandRouting, RepeatedExecutionUsesCachedExternalRoute) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto program = parse_line("run alpha");
+    ASSERT_TRUE(program.has_value());
+
+    EXPECT_EQ(interp.execute_program(**program), 0);
+    const auto& node = std::get<CommandNode>((*program)->statements[0]);
+    EXPECT_EQ(node.route, CommandRoute::External);
+
+    EXPECT_EQ(interp.execute_program(**program), 0);
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 2u);
+    EXPECT_EQ(executed[1].executable.string(), "run");
+}
+
+TEST(CommandRouting, FunctionDefinitionInvalidatesCachedRoute) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto call = parse_line("greet");
+    ASSERT_TRUE(call.has_value());
+
+    // First execution routes to an external process named "greet"
+    EXPECT_EQ(interp.execute_program(**call), 0);
+    ASSERT_EQ(interp.executor().policy().executed_commands.size(), 1u);
+    EXPECT_EQ(interp.executor().policy().executed_commands[0].executable.string(), "greet");
+
+    // Defining the function bumps the generation, so the cached External
+    // route re-resolves and the same plan now runs the function body
+    auto definition = parse_line("function greet do run inner; done");
+    ASSERT_TRUE(definition.has_value());
+    EXPECT_EQ(interp.execute_program(**definition), 0);
+
+    EXPECT_EQ(interp.execute_program(**call), 0);
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 2u);
+    EXPECT_EQ(executed[1].executable.string(), "run");
+}
+
+TEST(CommandRouting, ExpandedNamesAreNeverCached) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+    interp.set_variable("c", "first");
+
+    auto program = parse_line("$c arg");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    const auto& node = std::get<CommandNode>((*program)->statements[0]);
+    EXPECT_EQ(node.route, CommandRoute::Unresolved);
+
+    // The same plan resolves the new name on re-execution
+    interp.set_variable("c", "second");
+    EXPECT_EQ(interp.execute_program(**program), 0);
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 2u);
+    EXPECT_EQ(executed[0].executable.string(), "first");
+    EXPECT_EQ(executed[1].executable.string(), "second");
+}
+
+}  // namespace
@@ -0,0 +1,106 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/completion_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace wshell;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Scratch $PATH directory populated with fake executables
+class CompletionIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() /
+               ("wshell_completion_" + std::to_string(::getpid()));
+        fs::create_directories(dir_);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(dir_, ec);
+    }
+
+    void add_executable(const std::string& name) {
+        auto path = dir_ / name;
+        std::ofstream(path) << "#!/bin/sh\n";
+        fs::permissions(path, fs::perms::owner_all, fs::perm_options::replace);
+    }
+
+    void add_plain_file(const std::string& name) {
+        std::ofstream(dir_ / name) << "not a program\n";
+        fs::permissions(dir_ / name, fs::perms::owner_read, fs::perm_options::replace);
+    }
+
+    fs::path dir_;
+};
+
+TEST_F(CompletionIndexTest, PrefixQueryReturnsSortedExecutables) {
+    add_executable("grep");
+    add_executable("grip");
+    add_executable("cat");
+    add_plain_file("grumble");  // not executable: must not complete
+
+    CompletionIndex index(dir_.string());
+    EXPECT_EQ(index.command_count(), 3u);
+
+    auto matches = index.complete("gr");
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], "grep");
+    EXPECT_EQ(matches[1], "grip");
+    EXPECT_TRUE(index.contains_command("cat"));
+    EXPECT_FALSE(index.contains_command("grumble"));
+}
+
+TEST_F(CompletionIndexTest, RefreshRescansOnlyChangedDirectories) {
+    add_executable("alpha");
+    CompletionIndex index(dir_.string() + ":" + dir_.string());
+
+    // Nothing changed: refresh touches no directory
+    EXPECT_EQ(index.refresh(), 0u);
+
+    add_executable("beta");
+    // Both snapshot entries point at the (one) changed directory
+    EXPECT_GT(index.refresh(), 0u);
+    EXPECT_TRUE(index.contains_command("beta"));
+}
+
+TEST_F(CompletionIndexTest, HistoryWordsMergeWithPathMatches) {
+    add_executable("build");
+    CompletionIndex index(dir_.string());
+
+    index.note_history("buy-groceries --now");
+    index.note_history("   build -j4");  // duplicate of a PATH entry
+    index.note_history("unrelated thing");
+
+    auto matches = index.complete("bu");
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], "build");  // deduplicated across both indexes
+    EXPECT_EQ(matches[1], "buy-groceries");
+}
+
+TEST_F(CompletionIndexTest, ResultCapBoundsTheMerge) {
+    for (char c = 'a'; c <= 'z'; ++c) {
+        add_executable(std::string("tool-") + c);
+    }
+    CompletionIndex index(dir_.string());
+
+    auto matches = index.complete("tool-", 5);
+    ASSERT_EQ(matches.size(), 5u);
+    EXPECT_EQ(matches[0], "tool-a");
+    EXPECT_EQ(matches[4], "tool-e");
+}
+
+TEST_F(CompletionIndexTest, MissingDirectoryContributesNothing) {
+    CompletionIndex index((dir_ / "does_not_exist").string());
+    EXPECT_EQ(index.command_count(), 0u);
+    EXPECT_TRUE(index.complete("x").empty());
+}
+
+}  // namespace
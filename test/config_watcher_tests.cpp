@@ -0,0 +1,102 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/config_watcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace wshell;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Tests drive poll_once() directly instead of waiting on the watch thread,
+// so reloads are deterministic. mtime granularity can be coarse, so every
+// rewrite bumps the timestamp explicitly.
+class ConfigWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() /
+               ("wshell_cfgwatch_" + std::to_string(::getpid()));
+        fs::create_directories(dir_);
+        path_ = dir_ / "wshellrc";
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(dir_, ec);
+    }
+
+    void write_config(const std::string& content) {
+        { std::ofstream(path_) << content; }
+        // Make the change visible to the (mtime, size) stamp even when the
+        // rewrite lands within the filesystem's timestamp granularity
+        fs::last_write_time(path_, fs::last_write_time(path_) + std::chrono::seconds(2));
+    }
+
+    fs::path dir_;
+    fs::path path_;
+};
+
+TEST_F(ConfigWatcherTest, InitialLoadAndReloadOnChange) {
+    write_config("PS1=one>\n");
+    ConfigWatcher watcher(path_);
+    EXPECT_EQ(watcher.get("PS1"), "one>");
+
+    // Unchanged file: polling is a no-op
+    EXPECT_FALSE(watcher.poll_once());
+
+    write_config("PS1=two>\nPS2=more>\n");
+    EXPECT_TRUE(watcher.poll_once());
+    EXPECT_EQ(watcher.get("PS1"), "two>");
+    EXPECT_EQ(watcher.get("PS2"), "more>");
+}
+
+TEST_F(ConfigWatcherTest, PinnedSnapshotSurvivesReload) {
+    write_config("PS1=before>\n");
+    ConfigWatcher watcher(path_);
+
+    const auto pinned = watcher.snapshot();
+    write_config("PS1=after>\n");
+    ASSERT_TRUE(watcher.poll_once());
+
+    // The reader that pinned before the reload keeps a consistent view;
+    // new readers see the new snapshot
+    EXPECT_EQ(pinned->at("PS1"), "before>");
+    EXPECT_EQ(watcher.get("PS1"), "after>");
+}
+
+TEST_F(ConfigWatcherTest, SeededConstructorSkipsStartupParse) {
+    write_config("PS1=file>\n");
+    ConfigWatcher::Variables seeded{{"PS1", "seeded>"}};
+    ConfigWatcher watcher(path_, std::move(seeded));
+
+    // The seed is authoritative until the file actually changes
+    EXPECT_EQ(watcher.get("PS1"), "seeded>");
+    EXPECT_EQ(watcher.reload_count(), 0u);
+
+    write_config("PS1=changed>\n");
+    ASSERT_TRUE(watcher.poll_once());
+    EXPECT_EQ(watcher.get("PS1"), "changed>");
+}
+
+TEST_F(ConfigWatcherTest, VanishedFilePublishesEmptySnapshot) {
+    write_config("PS1=gone>\n");
+    ConfigWatcher watcher(path_);
+    ASSERT_EQ(watcher.get("PS1"), "gone>");
+
+    fs::remove(path_);
+    EXPECT_TRUE(watcher.poll_once());
+    EXPECT_FALSE(watcher.get("PS1").has_value());
+}
+
+TEST_F(ConfigWatcherTest, MissingKeyReturnsNullopt) {
+    write_config("PS1=x\n");
+    ConfigWatcher watcher(path_);
+    EXPECT_FALSE(watcher.get("NOT_SET").has_value());
+}
+
+}  // namespace
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/ast.hpp"
+#include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+using namespace wshell;
+
+namespace {
+
+TEST(ForLoopParse, BasicLoopStructure) {
+    auto result = parse_line("for f in a b c do echo $f; done");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ((*result)->statements.size(), 1u);
+    const auto& stmt = (*result)->statements[0];
+    ASSERT_TRUE(std::holds_alternative<ForNode>(stmt));
+    const auto& loop = std::get<ForNode>(stmt);
+    EXPECT_EQ(loop.variable, "f");
+    ASSERT_EQ(loop.values.size(), 3u);
+    EXPECT_EQ(loop.values[0].text, "a");
+    EXPECT_EQ(loop.values[2].text, "c");
+    EXPECT_FALSE(loop.parallel);
+    // "echo $f;" carries a trailing semicolon, so the body statement is a
+    // single-element sequence wrapping the command (parse_list behaviour)
+    ASSERT_EQ(loop.body.size(), 1u);
+    const auto& seq = std::get<SequenceNode>(loop.body[0]);
+    ASSERT_EQ(seq.statements.size(), 1u);
+    EXPECT_TRUE(std::holds_alternative<CommandNode>(seq.statements[0]));
+}
+
+TEST(ForLoopParse, ParallelMarkerWithJobBound) {
+    auto result = parse_line("for f in a b par 4 do touch $f; done");
+    ASSERT_TRUE(result.has_value());
+    const auto& loop = std::get<ForNode>((*result)->statements[0]);
+    EXPECT_TRUE(loop.parallel);
+    EXPECT_EQ(loop.max_jobs, 4u);
+}
+
+TEST(ForLoopParse, OverflowingJobBoundIsSyntaxError) {
+    // Regression: an out-of-range bound used to throw out of std::stoul and
+    // abort the shell; it must surface as a parse error instead
+    auto result = parse_line("for i in a par 99999999999999999999 do echo hi; done");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind_, ParseErrorKind::SyntaxError);
+}
+
+TEST(ForLoopParse, MissingDoneIsIncompleteInput) {
+    auto result = parse_line("for f in a b do echo $f");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind_, ParseErrorKind::IncompleteInput);
+}
+
+TEST(ForLoopParse, MissingDoAtEndOfInputIsIncompleteInput) {
+    auto result = parse_line("for f in a b");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind_, ParseErrorKind::IncompleteInput);
+}
+
+TEST(ForLoopExecute, SequentialIterationWithBinding) {
+    auto program = parse_line("for f in x y z do run $f; done");
+    ASSERT_TRUE(program.has_value());
+
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    EXPECT_EQ(interp.execute_program(**program), 0);
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 3u);
+    EXPECT_EQ(executed[0].args[0].value, "x");
+    EXPECT_EQ(executed[2].args[0].value, "z");
+    // Bash behaviour: the loop variable keeps its last value afterwards
+    EXPECT_EQ(interp.get_variable("f").value_or(""), "z");
+}
+
+TEST(ForLoopExecute, ParallelIterationExpandsPerIteration) {
+    // max_jobs of 1 keeps the fake policy's recording single-threaded
+    auto program = parse_line("for f in x y par 1 do run item-$f; done");
+    ASSERT_TRUE(program.has_value());
+
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    EXPECT_EQ(interp.execute_program(**program), 0);
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 2u);
+    EXPECT_EQ(executed[0].args[0].value, "item-x");
+    EXPECT_EQ(executed[1].args[0].value, "item-y");
+}
+
+TEST(ForLoopExecute, ParallelBodyRejectsAssignments) {
+    auto program = parse_line("for f in a b par do let x = 1; done");
+    ASSERT_TRUE(program.has_value());
+
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    // Surfaced as an execution error, so the program exits non-zero
+    EXPECT_NE(interp.execute_program(**program), 0);
+    EXPECT_TRUE(interp.executor().policy().executed_commands.empty());
+}
+
+}  // namespace
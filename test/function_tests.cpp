@@ -0,0 +1,91 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/ast.hpp"
+#include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+using namespace wshell;
+
+namespace {
+
+TEST(FunctionParse, BasicStructure) {
+    auto result = parse_line("function greet do echo hi; done");
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ((*result)->statements.size(), 1u);
+    const auto& stmt = (*result)->statements[0];
+    ASSERT_TRUE(std::holds_alternative<FunctionNode>(stmt));
+    const auto& fn = std::get<FunctionNode>(stmt);
+    EXPECT_EQ(fn.name, "greet");
+    // "echo hi;" carries a trailing semicolon, so the body statement is a
+    // single-element sequence wrapping the command (parse_list behaviour)
+    ASSERT_EQ(fn.body.size(), 1u);
+    const auto& seq = std::get<SequenceNode>(fn.body[0]);
+    ASSERT_EQ(seq.statements.size(), 1u);
+    EXPECT_TRUE(std::holds_alternative<CommandNode>(seq.statements[0]));
+}
+
+TEST(FunctionParse, MissingDoneIsIncompleteInput) {
+    auto result = parse_line("function greet do echo hi");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind_, ParseErrorKind::IncompleteInput);
+}
+
+TEST(FunctionExecute, InvocationBindsPositionals) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto definition = parse_line("function greet do run hi-$1 and-$2; done");
+    ASSERT_TRUE(definition.has_value());
+    EXPECT_EQ(interp.execute_program(**definition), 0);
+    // Defining spawns nothing
+    EXPECT_TRUE(interp.executor().policy().executed_commands.empty());
+
+    auto call = parse_line("greet world extra");
+    ASSERT_TRUE(call.has_value());
+    EXPECT_EQ(interp.execute_program(**call), 0);
+
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 1u);
+    EXPECT_EQ(executed[0].args[0].value, "hi-world");
+    EXPECT_EQ(executed[0].args[1].value, "and-extra");
+}
+
+TEST(FunctionExecute, PositionalsRestoredAfterCall) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+    interp.set_variable("1", "outer");
+
+    auto definition = parse_line("function f do run $1; done");
+    ASSERT_TRUE(definition.has_value());
+    EXPECT_EQ(interp.execute_program(**definition), 0);
+
+    auto call = parse_line("f inner");
+    ASSERT_TRUE(call.has_value());
+    EXPECT_EQ(interp.execute_program(**call), 0);
+
+    EXPECT_EQ(interp.get_variable("1").value_or(""), "outer");
+}
+
+TEST(FunctionExecute, RecursionDepthIsBounded) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto definition = parse_line("function loop do loop; done");
+    ASSERT_TRUE(definition.has_value());
+    EXPECT_EQ(interp.execute_program(**definition), 0);
+
+    auto call = parse_line("loop");
+    ASSERT_TRUE(call.has_value());
+    // Hits the call-depth guard instead of overflowing the stack
+    EXPECT_NE(interp.execute_program(**call), 0);
+}
+
+}  // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/glob.hpp"
+#include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+using namespace wshell;
+namespace fs = std::filesystem;
+
+namespace {
+
+TEST(GlobPattern, CompiledMatcherCoversMetacharacters) {
+    EXPECT_TRUE(GlobPattern("*.log").match("build.log"));
+    EXPECT_FALSE(GlobPattern("*.log").match("build.txt"));
+    EXPECT_TRUE(GlobPattern("file?.c").match("file1.c"));
+    EXPECT_FALSE(GlobPattern("file?.c").match("file12.c"));
+    EXPECT_TRUE(GlobPattern("[a-c]*").match("beta"));
+    EXPECT_FALSE(GlobPattern("[!a-c]*").match("beta"));
+    EXPECT_TRUE(GlobPattern("a*b*c").match("aXXbYYc"));
+    EXPECT_TRUE(GlobPattern("*").match("anything"));
+    EXPECT_TRUE(GlobPattern("*").match(""));  // fnmatch semantics
+    // Unterminated bracket is a literal
+    EXPECT_TRUE(GlobPattern("a[b").match("a[b"));
+}
+
+TEST(GlobPattern, RangeToByte255CompilesAndTerminates) {
+    // Regression: a set range whose upper bound is byte 0xFF used to spin
+    // forever at compile time (unsigned char wrap), freezing the shell on
+    // input like `echo [a-\xff]` before any filesystem work
+    GlobPattern pattern("[a-\xff]x");
+    EXPECT_TRUE(pattern.match("bx"));
+    EXPECT_TRUE(pattern.match("\xff" "x"));
+    EXPECT_FALSE(pattern.match("Ax"));
+}
+
+// Scratch directory tree for expansion tests
+class GlobExpandTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = fs::temp_directory_path() / ("wshell_glob_" + std::to_string(::getpid()));
+        fs::create_directories(root_ / "a");
+        fs::create_directories(root_ / "b");
+        touch("a/one.c");
+        touch("a/two.c");
+        touch("a/one.h");
+        touch("b/three.c");
+        touch("a/.hidden.c");
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(root_, ec);
+    }
+
+    void touch(const std::string& rel) { std::ofstream(root_ / rel) << ""; }
+
+    [[nodiscard]] std::string p(const std::string& rel) const {
+        return (root_ / rel).string();
+    }
+
+    fs::path root_;
+};
+
+TEST_F(GlobExpandTest, SortedMatchesAndDotfileHiding) {
+    GlobExpander expander;
+    auto matches = expander.expand(p("a/*.c"));
+    ASSERT_EQ(matches.size(), 2u);  // .hidden.c excluded
+    EXPECT_EQ(matches[0], p("a/one.c"));
+    EXPECT_EQ(matches[1], p("a/two.c"));
+
+    // A leading dot in the segment opts into dotfiles
+    EXPECT_EQ(expander.expand(p("a/.*.c")).size(), 1u);
+}
+
+TEST_F(GlobExpandTest, GlobInIntermediateSegment) {
+    GlobExpander expander;
+    auto matches = expander.expand(p("*/one.c"));
+    ASSERT_EQ(matches.size(), 1u);
+    EXPECT_EQ(matches[0], p("a/one.c"));
+}
+
+TEST_F(GlobExpandTest, DirectoryListingsAreCachedPerExpander) {
+    GlobExpander expander;
+    (void)expander.expand(p("a/*.c"));
+    (void)expander.expand(p("a/*.h"));
+    // Both patterns enumerate the same directory: one cache entry
+    EXPECT_EQ(expander.cached_directories(), 1u);
+}
+
+TEST_F(GlobExpandTest, NoMatchesReturnsEmpty) {
+    GlobExpander expander;
+    EXPECT_TRUE(expander.expand(p("a/*.zig")).empty());
+    EXPECT_TRUE(expander.expand(p("missing/*.c")).empty());
+}
+
+TEST_F(GlobExpandTest, InterpreterExpandsUnquotedArguments) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto program = parse_line("run " + p("a/*.c") + " " + p("a/*.zig"));
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 1u);
+    // Matches expand in place; the unmatched pattern passes through literally
+    ASSERT_EQ(executed[0].args.size(), 3u);
+    EXPECT_EQ(executed[0].args[0].value, p("a/one.c"));
+    EXPECT_EQ(executed[0].args[1].value, p("a/two.c"));
+    EXPECT_EQ(executed[0].args[2].value, p("a/*.zig"));
+}
+
+}  // namespace
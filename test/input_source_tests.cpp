@@ -0,0 +1,64 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/input_source.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace {
+
+using wshell::ReadaheadInputSource;
+using wshell::StreamInputSource;
+
+TEST(ReadaheadInputSourceTest, DeliversLinesInOrder) {
+    std::istringstream input("one\ntwo\nthree\n");
+    StreamInputSource stream(input, "test");
+    ReadaheadInputSource readahead(stream);
+
+    auto first = readahead.read_line();
+    auto second = readahead.read_line();
+    auto third = readahead.read_line();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(*first, "one");
+    EXPECT_EQ(*second, "two");
+    EXPECT_EQ(*third, "three");
+}
+
+TEST(ReadaheadInputSourceTest, EndOfInputIsSticky) {
+    std::istringstream input("only\n");
+    StreamInputSource stream(input, "test");
+    ReadaheadInputSource readahead(stream);
+
+    ASSERT_TRUE(readahead.read_line().has_value());
+    auto eof1 = readahead.read_line();
+    auto eof2 = readahead.read_line();
+    ASSERT_FALSE(eof1.has_value());
+    ASSERT_FALSE(eof2.has_value());
+    EXPECT_EQ(eof1.error(), "End of input");
+    EXPECT_EQ(eof2.error(), "End of input");
+}
+
+TEST(ReadaheadInputSourceTest, DestructorJoinsWithUndrainedLines) {
+    std::istringstream input("a\nb\nc\nd\n");
+    StreamInputSource stream(input, "test");
+    {
+        ReadaheadInputSource readahead(stream, 2);
+        auto line = readahead.read_line();
+        ASSERT_TRUE(line.has_value());
+        EXPECT_EQ(*line, "a");
+        // remaining buffered lines are discarded on destruction
+    }
+}
+
+TEST(ReadaheadInputSourceTest, SourceNameMarksTheDecorator) {
+    std::istringstream input("");
+    StreamInputSource stream(input, "stdin");
+    ReadaheadInputSource readahead(stream);
+    EXPECT_EQ(readahead.source_name(), "stdin (readahead)");
+}
+
+}  // namespace
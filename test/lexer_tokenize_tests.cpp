@@ -0,0 +1,48 @@
+// lexer_tokenize_tests.cpp
+// Unit tests for batch tokenization (Lexer::tokenize / Lexer::tokenize_buffer)
+
+#include "gtest/gtest.h"
+#include "shell/lexer.hpp"
+#include <string>
+
+using namespace wshell;
+
+TEST(LexerTokenize, TokenizeBufferSimpleCommand) {
+    auto buffer = Lexer::tokenize_buffer("echo hello | grep h");
+    ASSERT_EQ(buffer.size(), 6u);
+    EXPECT_EQ(buffer[0].type, TokenType::Identifier);
+    EXPECT_EQ(buffer[0].value, "echo");
+    EXPECT_EQ(buffer[2].type, TokenType::Pipe);
+    EXPECT_EQ(buffer[5].type, TokenType::EndOfFile);
+}
+
+TEST(LexerTokenize, TokenBufferIsSelfContained) {
+    TokenBuffer buffer;
+    {
+        // The source string dies here; the buffer must keep its own copy.
+        std::string source = "ls -l /tmp\n";
+        buffer = Lexer::tokenize_buffer(source);
+    }
+    ASSERT_EQ(buffer.size(), 5u);
+    EXPECT_EQ(buffer[0].value, "ls");
+    EXPECT_EQ(buffer[1].value, "-l");
+    EXPECT_EQ(buffer[2].value, "/tmp");
+    EXPECT_EQ(buffer[3].type, TokenType::Newline);
+}
+
+TEST(LexerTokenize, TokenizeBufferMatchesTokenize) {
+    const std::string source = "let X = 42 ; echo $X > out.txt\n# done\n";
+    auto vec = Lexer::tokenize(source);
+    auto buffer = Lexer::tokenize_buffer(source);
+    ASSERT_EQ(buffer.size(), vec.size());
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        EXPECT_EQ(buffer[i].type, vec[i].type) << "token " << i;
+        EXPECT_EQ(buffer[i].value, vec[i].value) << "token " << i;
+    }
+}
+
+TEST(LexerTokenize, TokenizeBufferEmptyInput) {
+    auto buffer = Lexer::tokenize_buffer("");
+    ASSERT_EQ(buffer.size(), 1u);
+    EXPECT_EQ(buffer[0].type, TokenType::EndOfFile);
+}
@@ -411,3 +411,39 @@ TEST(ParserContinuation_Diagnostics, AssignmentWhitespaceSemicolonPipe) {
     expect_syntax_error("FOO=bar ; |");
     expect_syntax_error("FOO=bar;|");
 }
+
+// -----------------------------------------------------------------------------
+// ParserSession: incremental continuation (lex each line once)
+// -----------------------------------------------------------------------------
+
+TEST(ParserSession_Tests, SingleFeedMatchesParseLine) {
+    wshell::ParserSession session;
+    auto via_session = session.feed("echo hello world | grep hello");
+    auto via_parse_line = wshell::parse_line("echo hello world | grep hello");
+    ASSERT_TRUE(via_session.has_value())
+        << "Session parse failed: " << via_session.error().to_string();
+    ASSERT_TRUE(via_parse_line.has_value());
+    EXPECT_EQ(wshell::to_string(**via_session), wshell::to_string(**via_parse_line));
+}
+
+TEST(ParserSession_Tests, SyntaxErrorsSurfaceThroughSession) {
+    wshell::ParserSession session;
+    auto result = session.feed("echo hi |");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().kind_, wshell::ParseErrorKind::SyntaxError);
+}
+
+TEST(ParserSession_Tests, ResetStartsAFreshStatement) {
+    wshell::ParserSession session;
+    ASSERT_FALSE(session.feed("echo hi |").has_value());
+    session.reset();
+    EXPECT_EQ(session.line_count(), 0u);
+    auto result = session.feed("echo ok");
+    ASSERT_TRUE(result.has_value()) << result.error().to_string();
+}
+
+TEST(ParserSession_Tests, LineCountTracksFeeds) {
+    wshell::ParserSession session;
+    (void)session.feed("echo a; echo b");
+    EXPECT_EQ(session.line_count(), 1u);
+}
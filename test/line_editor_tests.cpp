@@ -0,0 +1,150 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/line_editor.hpp"
+#include "shell/output_destination.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace wshell;
+namespace fs = std::filesystem;
+
+namespace {
+
+// The editor is a pure byte-driven state machine, so every test drives it
+// with raw keystroke bytes and inspects the terminal traffic captured by a
+// StringOutputDestination — no tty involved.
+class LineEditorTest : public ::testing::Test {
+protected:
+    LineEditorTest() : out_("terminal"), editor_(out_, "$ ") {}
+
+    void begin() {
+        editor_.begin();
+        out_.clear();  // drop the initial prompt paint
+    }
+
+    StringOutputDestination out_;
+    LineEditor editor_;
+};
+
+TEST_F(LineEditorTest, TypingAtEndOfLineEmitsOnlyTheTypedBytes) {
+    begin();
+    editor_.feed("ls");
+    // Appending at the end damages nothing before the cursor: the wire
+    // traffic is exactly the echoed characters, no repaints
+    EXPECT_EQ(out_.captured_output(), "ls");
+    EXPECT_EQ(editor_.line(), "ls");
+}
+
+TEST_F(LineEditorTest, InsertionInTheMiddleRepaintsOnlyTheDamagedTail) {
+    begin();
+    editor_.feed("echo ad");
+    editor_.feed("\x1b[D");  // Left: cursor between 'a' and 'd'
+    out_.clear();
+    editor_.feed("n");  // "echo and"
+    EXPECT_EQ(editor_.line(), "echo and");
+    // Damage starts at the inserted character: rewrite "nd" (columns 9-10
+    // of the frame "$ echo and"), then park the cursor after the 'n'
+    EXPECT_EQ(out_.captured_output(), "nd\x1b[10G");
+}
+
+TEST_F(LineEditorTest, BackspaceErasesTheStaleTail) {
+    begin();
+    editor_.feed("abc");
+    out_.clear();
+    editor_.feed("\x7f");
+    EXPECT_EQ(editor_.line(), "ab");
+    // Shrinking the line erases to end-of-line after the damage point
+    EXPECT_EQ(out_.captured_output(), "\x1b[5G\x1b[K");
+}
+
+TEST_F(LineEditorTest, SubmitAndControlKeys) {
+    begin();
+    editor_.feed("hello world");
+    editor_.feed("\x17");  // Ctrl-W kills "world"
+    EXPECT_EQ(editor_.line(), "hello ");
+    editor_.feed("\x15");  // Ctrl-U kills the line
+    EXPECT_EQ(editor_.line(), "");
+    editor_.feed("done");
+    EXPECT_EQ(editor_.feed("\r"), LineEditor::Status::Submitted);
+    EXPECT_EQ(editor_.line(), "done");
+
+    // Ctrl-D on an empty line ends input
+    begin();
+    EXPECT_EQ(editor_.feed("\x04"), LineEditor::Status::EndOfInput);
+}
+
+TEST_F(LineEditorTest, HistoryNavigationRestoresThePendingLine) {
+    History history(8);
+    history.push("first");
+    history.push("second");
+    editor_.set_history(&history);
+
+    begin();
+    editor_.feed("dra");        // in-progress line
+    editor_.feed("\x1b[A");     // Up -> "second"
+    EXPECT_EQ(editor_.line(), "second");
+    editor_.feed("\x1b[A");     // Up -> "first"
+    EXPECT_EQ(editor_.line(), "first");
+    editor_.feed("\x1b[B");     // Down -> "second"
+    editor_.feed("\x1b[B");     // Down past newest -> stashed line back
+    EXPECT_EQ(editor_.line(), "dra");
+}
+
+TEST_F(LineEditorTest, CtrlRStepsThroughHistoryMatches) {
+    History history(8);
+    history.push("make build");
+    history.push("ls");
+    history.push("make test");
+    editor_.set_history(&history);
+
+    begin();
+    editor_.feed("make");
+    editor_.feed("\x12");  // Ctrl-R: newest match first
+    EXPECT_EQ(editor_.line(), "make test");
+    editor_.feed("\x12");  // older match
+    EXPECT_EQ(editor_.line(), "make build");
+}
+
+TEST_F(LineEditorTest, TabCompletionViaCompletionIndex) {
+    // A scratch bin directory with two executables sharing a prefix
+    const fs::path bin =
+        fs::temp_directory_path() / ("wshell_editor_" + std::to_string(::getpid()));
+    fs::create_directories(bin);
+    for (const char* name : {"gitk", "gitgui"}) {
+        std::ofstream(bin / name) << "#!/bin/sh\n";
+        fs::permissions(bin / name, fs::perms::owner_all);
+    }
+    CompletionIndex index(bin.string());
+    editor_.set_completion_index(&index);
+
+    begin();
+    editor_.feed("gi");
+    editor_.feed("\t");  // ambiguous: extends to the common prefix "git"
+    EXPECT_EQ(editor_.line(), "git");
+    editor_.feed("k");
+    editor_.feed("\t");  // unique: completes to "gitk"
+    EXPECT_EQ(editor_.line(), "gitk");
+
+    std::error_code ec;
+    fs::remove_all(bin, ec);
+}
+
+TEST_F(LineEditorTest, BindingsArePluggable) {
+    bool fired = false;
+    editor_.bind(Key::CtrlK, [&fired](LineEditor& ed) {
+        fired = true;
+        ed.kill_to_end();
+    });
+    begin();
+    editor_.feed("abcd");
+    editor_.feed("\x01");  // Ctrl-A: home
+    editor_.feed("\x0b");  // Ctrl-K through the custom binding
+    EXPECT_TRUE(fired);
+    EXPECT_EQ(editor_.line(), "");
+}
+
+}  // namespace
@@ -0,0 +1,73 @@
+// output_destination_tests.cpp
+// Unit tests for buffered and vectored output destinations
+
+#include "gtest/gtest.h"
+#include "shell/output_destination.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+using wshell::BufferedOutputDestination;
+using wshell::StringOutputDestination;
+
+TEST(OutputDestinationTests, WriteManyDefaultPreservesOrder) {
+    StringOutputDestination sink;
+    std::array<std::string_view, 3> pieces = {"$ ", "echo hello", "\n"};
+    ASSERT_TRUE(sink.write_many(pieces).has_value());
+    EXPECT_EQ(sink.captured_output(), "$ echo hello\n");
+}
+
+TEST(OutputDestinationTests, BufferedHoldsSmallWritesUntilFlush) {
+    StringOutputDestination sink;
+    BufferedOutputDestination buffered(sink, 64);
+    ASSERT_TRUE(buffered.write("prompt> ").has_value());
+    ASSERT_TRUE(buffered.write("ls -l\n").has_value());
+    EXPECT_EQ(sink.captured_output(), "");  // nothing reached the sink yet
+    ASSERT_TRUE(buffered.flush().has_value());
+    EXPECT_EQ(sink.captured_output(), "prompt> ls -l\n");
+}
+
+TEST(OutputDestinationTests, BufferedDrainsWhenChunkFills) {
+    StringOutputDestination sink;
+    BufferedOutputDestination buffered(sink, 8);
+    ASSERT_TRUE(buffered.write("abcd").has_value());
+    ASSERT_TRUE(buffered.write("efgh").has_value());  // exactly fills the chunk
+    ASSERT_TRUE(buffered.write("i").has_value());     // forces a drain first
+    EXPECT_EQ(sink.captured_output(), "abcdefgh");
+    ASSERT_TRUE(buffered.flush().has_value());
+    EXPECT_EQ(sink.captured_output(), "abcdefghi");
+}
+
+TEST(OutputDestinationTests, BufferedPassesOversizedWritesThrough) {
+    StringOutputDestination sink;
+    BufferedOutputDestination buffered(sink, 4);
+    std::string big(16, 'x');
+    ASSERT_TRUE(buffered.write(big).has_value());
+    EXPECT_EQ(sink.captured_output(), big);  // bypassed the chunk buffer
+}
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+TEST(OutputDestinationTests, FdWriteManyIssuesSingleGatheredWrite) {
+    const char* path = "/tmp/wshell_fd_dest_test.txt";
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    {
+        wshell::FdOutputDestination dest(fd, "testfile");
+        std::array<std::string_view, 4> pieces = {"one ", "two ", "three", "\n"};
+        ASSERT_TRUE(dest.write_many(pieces).has_value());
+    }
+    ::close(fd);
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    EXPECT_EQ(contents.str(), "one two three\n");
+}
+#endif
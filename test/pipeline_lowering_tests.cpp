@@ -0,0 +1,118 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/ast.hpp"
+#include "shell/parser.hpp"
+#include "shell/shell_interpreter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+using namespace wshell;
+
+namespace {
+
+// A multi-stage pipeline should reach the executor as one lowered Pipeline
+// (one executor call), not as N independent command executions; the fake
+// policy's executed_pipelines vector makes that observable directly.
+
+TEST(PipelineLowering, MultiStagePipelineReachesExecutorAsOnePipeline) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto program = parse_line("alpha one | beta | gamma two");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    const auto& pipelines = interp.executor().policy().executed_pipelines;
+    ASSERT_EQ(pipelines.size(), 1u);
+    ASSERT_EQ(pipelines[0].size(), 3u);
+    EXPECT_EQ(pipelines[0].commands[0].executable.string(), "alpha");
+    EXPECT_EQ(pipelines[0].commands[1].executable.string(), "beta");
+    EXPECT_EQ(pipelines[0].commands[2].executable.string(), "gamma");
+    ASSERT_EQ(pipelines[0].commands[2].args.size(), 1u);
+    EXPECT_EQ(pipelines[0].commands[2].args[0].value, "two");
+}
+
+TEST(PipelineLowering, ExpansionsResolveDuringLowering) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+    interp.set_variable("tool", "grep");
+    interp.set_variable("pattern", "error");
+
+    auto program = parse_line("$tool $pattern | sort");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    const auto& pipelines = interp.executor().policy().executed_pipelines;
+    ASSERT_EQ(pipelines.size(), 1u);
+    ASSERT_EQ(pipelines[0].size(), 2u);
+    EXPECT_EQ(pipelines[0].commands[0].executable.string(), "grep");
+    ASSERT_EQ(pipelines[0].commands[0].args.size(), 1u);
+    EXPECT_EQ(pipelines[0].commands[0].args[0].value, "error");
+}
+
+TEST(PipelineLowering, RedirectionsAttachToTheirStage) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto program = parse_line("alpha < in.txt | beta > out.txt");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    const auto& pipelines = interp.executor().policy().executed_pipelines;
+    ASSERT_EQ(pipelines.size(), 1u);
+    const auto* stdin_file = std::get_if<FileTarget>(&pipelines[0].commands[0].stdin_);
+    ASSERT_NE(stdin_file, nullptr);
+    EXPECT_EQ(stdin_file->path.string(), "in.txt");
+    const auto* stdout_file = std::get_if<FileTarget>(&pipelines[0].commands[1].stdout_);
+    ASSERT_NE(stdout_file, nullptr);
+    EXPECT_EQ(stdout_file->path.string(), "out.txt");
+    EXPECT_EQ(stdout_file->mode, OpenMode::WriteTruncate);
+}
+
+TEST(PipelineLowering, BuiltinStageFallsBackToSequentialDispatch) {
+    StringOutputDestination out("stdout");
+    StringOutputDestination err("stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    // `history` resolves to the in-process builtin, so this pipeline cannot
+    // be spawned whole — the builtin runs in-process and the external stage
+    // executes individually
+    auto program = parse_line("history | run alpha");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    EXPECT_TRUE(interp.executor().policy().executed_pipelines.empty());
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 1u);
+    EXPECT_EQ(executed[0].executable.string(), "run");
+}
+
+TEST(PipelineLowering, FunctionStageFallsBackToSequentialDispatch) {
+    StreamOutputDestination out(std::cout, "stdout");
+    StreamOutputDestination err(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(out, err);
+
+    auto definition = parse_line("function filter do run inner; done");
+    ASSERT_TRUE(definition.has_value());
+    EXPECT_EQ(interp.execute_program(**definition), 0);
+
+    auto program = parse_line("alpha | filter");
+    ASSERT_TRUE(program.has_value());
+    EXPECT_EQ(interp.execute_program(**program), 0);
+
+    // No lowered pipeline; both stages dispatched individually (the
+    // function body's `run inner` is the second recorded command)
+    EXPECT_TRUE(interp.executor().policy().executed_pipelines.empty());
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 2u);
+    EXPECT_EQ(executed[0].executable.string(), "alpha");
+    EXPECT_EQ(executed[1].executable.string(), "run");
+}
+
+}  // namespace
@@ -0,0 +1,45 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/plan_cache.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using wshell::PlanCache;
+
+TEST(PlanCacheTest, LookupMissesUntilMemoized) {
+    PlanCache cache;
+    EXPECT_EQ(cache.lookup("echo hello"), nullptr);
+    cache.memoize("echo hello");
+    EXPECT_NE(cache.lookup("echo hello"), nullptr);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(PlanCacheTest, HitReturnsStablePlan) {
+    PlanCache cache;
+    cache.memoize("echo a | grep a");
+    const auto* first = cache.lookup("echo a | grep a");
+    cache.memoize("echo a | grep a");  // no-op
+    EXPECT_EQ(cache.lookup("echo a | grep a"), first);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(PlanCacheTest, UnparsableLinesAreNotCached) {
+    PlanCache cache;
+    cache.memoize("echo hi |");
+    EXPECT_EQ(cache.lookup("echo hi |"), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(PlanCacheTest, FullCacheIsClearedBeforeInsert) {
+    PlanCache cache(2);
+    cache.memoize("echo one");
+    cache.memoize("echo two");
+    cache.memoize("echo three");  // hits the bound, clears, then inserts
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_NE(cache.lookup("echo three"), nullptr);
+}
+
+}  // namespace
@@ -30,9 +30,95 @@ TEST(HistoryTests, SetMaxTrimsHistory) {
     EXPECT_EQ(items[1], "three");
 }
 
+TEST(HistoryTests, RingBufferOverwritesOldestAtCapacity) {
+    History history(3);
+    history.push("one");
+    history.push("two");
+    history.push("three");
+    history.push("four");  // wraps: "one" is overwritten in place
+    EXPECT_EQ(history.size(), 3);
+    const auto items = history.items();
+    EXPECT_EQ(items[0], "two");
+    EXPECT_EQ(items[1], "three");
+    EXPECT_EQ(items[2], "four");
+}
+
+TEST(HistoryTests, SetMaxAfterWrapKeepsInsertionOrder) {
+    History history(3);
+    history.push("a");
+    history.push("b");
+    history.push("c");
+    history.push("d");
+    history.set_max(2);
+    const auto items = history.items();
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_EQ(items[0], "c");
+    EXPECT_EQ(items[1], "d");
+}
+
 TEST(HistoryTests, EmptyHistory) {
     History history;
     EXPECT_TRUE(history.empty());
     history.push("foo");
     EXPECT_FALSE(history.empty());
 }
+
+TEST(HistorySearchTests, SubstringMatchesMostRecentFirst) {
+    History history;
+    history.push("git status");
+    history.push("make clean");
+    history.push("git commit -m fix");
+    history.push("ls -l");
+
+    const auto matches = history.search("git");
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], "git commit -m fix");
+    EXPECT_EQ(matches[1], "git status");
+}
+
+TEST(HistorySearchTests, UnseenTrigramMatchesNothing) {
+    History history;
+    history.push("echo hello");
+    EXPECT_TRUE(history.search("xyz").empty());
+    EXPECT_TRUE(history.search("").empty());
+}
+
+TEST(HistorySearchTests, ShortPatternsFallBackToScan) {
+    History history;
+    history.push("cd /tmp");
+    history.push("ls");
+    const auto matches = history.search("cd");
+    ASSERT_EQ(matches.size(), 1u);
+    EXPECT_EQ(matches[0], "cd /tmp");
+}
+
+TEST(HistorySearchTests, EvictedEntriesStopMatching) {
+    History history(2);
+    history.push("needle one");
+    history.push("other");
+    history.push("another");  // evicts "needle one"
+
+    EXPECT_TRUE(history.search("needle").empty());
+    ASSERT_EQ(history.search("other").size(), 2u);
+}
+
+TEST(HistorySearchTests, ResultCapBoundsTheWalk) {
+    History history;
+    for (int i = 0; i < 50; ++i) {
+        history.push("ping host-" + std::to_string(i));
+    }
+    const auto matches = history.search("ping", 5);
+    ASSERT_EQ(matches.size(), 5u);
+    EXPECT_EQ(matches[0], "ping host-49");
+}
+
+TEST(HistorySearchTests, IndexSurvivesWrapAndRebuild) {
+    // Enough wraps to trip the stale-posting rebuild several times
+    History history(8);
+    for (int i = 0; i < 100; ++i) {
+        history.push("job-" + std::to_string(i) + " run");
+    }
+    const auto matches = history.search("job-9");
+    ASSERT_FALSE(matches.empty());
+    EXPECT_EQ(matches[0], "job-99 run");
+}
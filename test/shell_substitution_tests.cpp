@@ -121,3 +121,66 @@ TEST(ShellSubstitution, VariableExpansion_NestedQuotesLiteral) {
     std::string expanded = interp.expand_variables(cmd.arguments[0].text);
     EXPECT_EQ(expanded, "'Value: 42'");
 }
+
+// ----------------------------------------------------------------------------
+// Command substitution $(...)
+// ----------------------------------------------------------------------------
+
+TEST(CommandSubstitution, SubstitutesCapturedOutputIntoArgument) {
+    wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
+    wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(stdout_dest, stderr_dest);
+    interp.executor().policy().canned_stdout = "captured-value\n";
+
+    std::string expanded = interp.expand_variables("prefix-$(probe)-suffix");
+    // Trailing newline is stripped, output spliced in place
+    EXPECT_EQ(expanded, "prefix-captured-value-suffix");
+
+    // The inner command ran through the executor with stdout captured
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 1u);
+    EXPECT_EQ(executed[0].executable.string(), "probe");
+    EXPECT_TRUE(std::holds_alternative<CaptureTarget>(executed[0].stdout_));
+}
+
+TEST(CommandSubstitution, InnerWordsAreExpanded) {
+    wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
+    wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(stdout_dest, stderr_dest);
+    interp.set_variable("dir", "/tmp");
+
+    (void)interp.expand_variables("$(list $dir)");
+    const auto& executed = interp.executor().policy().executed_commands;
+    ASSERT_EQ(executed.size(), 1u);
+    ASSERT_EQ(executed[0].args.size(), 1u);
+    EXPECT_EQ(executed[0].args[0].value, "/tmp");
+}
+
+TEST(CommandSubstitution, LexerKeepsWholeSubstitutionInOneWord) {
+    auto result = parse_line("echo $(ls -l /tmp | wc -l)");
+    ASSERT_TRUE(result.has_value());
+    const auto& cmd = std::get<CommandNode>((*result)->statements[0]);
+    ASSERT_EQ(cmd.arguments.size(), 1u);
+    EXPECT_EQ(cmd.arguments[0].text, "$(ls -l /tmp | wc -l)");
+    EXPECT_TRUE(cmd.arguments[0].needs_expansion);
+}
+
+TEST(CommandSubstitution, UnterminatedSubstitutionIsLiteral) {
+    wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
+    wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
+    ShellInterpreter<FakeExecutionPolicy> interp(stdout_dest, stderr_dest);
+
+    EXPECT_EQ(interp.expand_variables("$(never closed"), "$(never closed");
+    EXPECT_TRUE(interp.executor().policy().executed_commands.empty());
+}
+
+#if !defined(_WIN32)
+TEST(CommandSubstitution, RealProcessOutputIsCaptured) {
+    wshell::StreamOutputDestination stdout_dest(std::cout, "stdout");
+    wshell::StreamOutputDestination stderr_dest(std::cerr, "stderr");
+    ShellInterpreter<> interp(stdout_dest, stderr_dest);
+
+    std::string expanded = interp.expand_variables("got:$(/bin/echo hello)");
+    EXPECT_EQ(expanded, "got:hello");
+}
+#endif
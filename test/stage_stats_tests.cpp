@@ -0,0 +1,69 @@
+// Copyright (c) 2024 William Sollers
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "shell/stage_stats.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using wshell::Stage;
+using wshell::StageStats;
+using wshell::StageTimer;
+
+class StageStatsTest : public ::testing::Test {
+protected:
+    // StageStats is process-wide; start each test from a clean slate
+    void SetUp() override { StageStats::instance().reset(); }
+    void TearDown() override { StageStats::instance().reset(); }
+};
+
+TEST_F(StageStatsTest, EmptyStageReportsZeroCount) {
+    const auto summary = StageStats::instance().summarize(Stage::Parse);
+    EXPECT_EQ(summary.count, 0u);
+    EXPECT_EQ(summary.p50_ns, 0u);
+}
+
+TEST_F(StageStatsTest, CountsAndPercentilesAreOrdered) {
+    auto& stats = StageStats::instance();
+    // 90 fast samples and 10 slow ones: p50 must land in the fast cluster,
+    // p99 in the slow one
+    for (int i = 0; i < 90; ++i) {
+        stats.record(Stage::Execute, 1'000);  // ~1us
+    }
+    for (int i = 0; i < 10; ++i) {
+        stats.record(Stage::Execute, 1'000'000);  // ~1ms
+    }
+
+    const auto summary = stats.summarize(Stage::Execute);
+    EXPECT_EQ(summary.count, 100u);
+    EXPECT_LT(summary.p50_ns, 10'000u);
+    EXPECT_GT(summary.p99_ns, 500'000u);
+    EXPECT_LE(summary.p50_ns, summary.p95_ns);
+    EXPECT_LE(summary.p95_ns, summary.p99_ns);
+}
+
+TEST_F(StageStatsTest, StagesAreIndependent) {
+    auto& stats = StageStats::instance();
+    stats.record(Stage::Parse, 500);
+    EXPECT_EQ(stats.summarize(Stage::Parse).count, 1u);
+    EXPECT_EQ(stats.summarize(Stage::Spawn).count, 0u);
+}
+
+TEST_F(StageStatsTest, ResetClearsAllStages) {
+    auto& stats = StageStats::instance();
+    stats.record(Stage::Parse, 500);
+    stats.record(Stage::Spawn, 500);
+    stats.reset();
+    EXPECT_EQ(stats.summarize(Stage::Parse).count, 0u);
+    EXPECT_EQ(stats.summarize(Stage::Spawn).count, 0u);
+}
+
+TEST_F(StageStatsTest, TimerRecordsOnScopeExit) {
+    {
+        StageTimer timer(Stage::Spawn);
+    }
+    EXPECT_EQ(StageStats::instance().summarize(Stage::Spawn).count, 1u);
+}
+
+}  // namespace
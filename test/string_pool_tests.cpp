@@ -0,0 +1,47 @@
+// string_pool_tests.cpp
+// Unit tests for the hash-consed string interning pool
+
+#include "gtest/gtest.h"
+#include "shell/string_pool.hpp"
+
+#include <string>
+#include <vector>
+
+using wshell::StringPool;
+
+TEST(StringPoolTests, InternReturnsEqualView) {
+    StringPool pool;
+    auto view = pool.intern("echo");
+    EXPECT_EQ(view, "echo");
+    EXPECT_EQ(pool.size(), 1u);
+}
+
+TEST(StringPoolTests, RepeatedInternIsHashConsed) {
+    StringPool pool;
+    // Two distinct source buffers with the same characters
+    std::string a = "git";
+    std::string b = "git";
+    auto first = pool.intern(a);
+    auto second = pool.intern(b);
+    EXPECT_EQ(first.data(), second.data());  // same canonical copy
+    EXPECT_EQ(pool.size(), 1u);
+}
+
+TEST(StringPoolTests, ViewsStayStableAcrossGrowth) {
+    StringPool pool;
+    auto early = pool.intern("stable-word");
+    const char* early_data = early.data();
+    for (int i = 0; i < 1000; ++i) {
+        (void)pool.intern("word-" + std::to_string(i));
+    }
+    EXPECT_EQ(pool.intern("stable-word").data(), early_data);
+    EXPECT_EQ(pool.size(), 1001u);
+}
+
+TEST(StringPoolTests, DistinctStringsGetDistinctEntries) {
+    StringPool pool;
+    auto ls = pool.intern("ls");
+    auto la = pool.intern("-la");
+    EXPECT_NE(ls.data(), la.data());
+    EXPECT_EQ(pool.size(), 2u);
+}
@@ -0,0 +1,60 @@
+// variable_store_tests.cpp
+// Unit tests for the flat-hash shell variable store
+
+#include "gtest/gtest.h"
+#include "shell/variable_store.hpp"
+#include <string>
+
+using wshell::VariableStore;
+
+TEST(VariableStoreTests, SetAndGet) {
+    VariableStore store;
+    EXPECT_TRUE(store.empty());
+    store.set("HOME", "/home/user");
+    store.set("PATH", "/usr/bin");
+    EXPECT_EQ(store.size(), 2u);
+    ASSERT_TRUE(store.get("HOME").has_value());
+    EXPECT_EQ(*store.get("HOME"), "/home/user");
+    EXPECT_FALSE(store.get("MISSING").has_value());
+}
+
+TEST(VariableStoreTests, OverwriteKeepsSingleEntry) {
+    VariableStore store;
+    store.set("X", "1");
+    store.set("X", "2");
+    EXPECT_EQ(store.size(), 1u);
+    EXPECT_EQ(*store.get("X"), "2");
+}
+
+TEST(VariableStoreTests, HeterogeneousLookupWithStringView) {
+    VariableStore store;
+    store.set("VAR", "value");
+    const std::string line = "prefix $VAR suffix";
+    std::string_view name = std::string_view(line).substr(8, 3);  // "VAR"
+    ASSERT_TRUE(store.get(name).has_value());
+    EXPECT_EQ(*store.get(name), "value");
+}
+
+TEST(VariableStoreTests, GrowsPastInitialCapacity) {
+    VariableStore store;
+    for (int i = 0; i < 500; ++i) {
+        store.set("VAR_" + std::to_string(i), std::to_string(i));
+    }
+    EXPECT_EQ(store.size(), 500u);
+    for (int i = 0; i < 500; ++i) {
+        auto value = store.get("VAR_" + std::to_string(i));
+        ASSERT_TRUE(value.has_value()) << "VAR_" << i;
+        EXPECT_EQ(*value, std::to_string(i));
+    }
+    // Insertion order is preserved in the contiguous entry array
+    EXPECT_EQ(store.entries().front().name, "VAR_0");
+    EXPECT_EQ(store.entries().back().name, "VAR_499");
+}
+
+TEST(VariableStoreTests, ClearEmptiesStore) {
+    VariableStore store;
+    store.set("A", "1");
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_FALSE(store.get("A").has_value());
+}